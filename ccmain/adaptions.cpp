@@ -41,6 +41,11 @@
 
 INT32 demo_word = 0;
 
+static INT32 cluster_compares = 0;     //comparisons made this page
+static INT32 cluster_prefiltered = 0;  //comparisons skipped by size/ink
+static INT32 cluster_capped = 0;       //comparisons skipped by the cap
+static INT32 cluster_dropped = 0;      //samples not collected due to cap
+
 #define EXTERN
 
 EXTERN BOOL_VAR (tessedit_reject_ems, FALSE, "Reject all m's");
@@ -58,6 +63,14 @@ EXTERN INT_VAR (tessedit_cluster_min_size, 3,
 "Smallest number of samples in a cluster for it to be used for adaption");
 EXTERN BOOL_VAR (tessedit_cluster_debug, FALSE,
 "Generate and print debug information for adaption by clustering");
+EXTERN BOOL_VAR (tessedit_cluster_prefilter, TRUE,
+"Skip clusters whose first sample differs grossly in size or ink");
+EXTERN double_VAR (tessedit_cluster_size_ratio, 2.0,
+"Largest size or ink ratio between a sample and a cluster worth matching");
+EXTERN INT_VAR (tessedit_cluster_max_compares, 0,
+"Most sample comparisons made while clustering a page (0 = no limit)");
+EXTERN BOOL_VAR (tessedit_cluster_stats, FALSE,
+"Print a per-page summary of clustering work done and avoided");
 EXTERN BOOL_VAR (tessedit_use_best_sample, FALSE,
 "Use best sample from cluster when adapting");
 EXTERN BOOL_VAR (tessedit_test_cluster_input, FALSE,
@@ -168,6 +181,11 @@ void collect_ems_for_adaption(WERD_RES *word,
   if (word->word->bounding_box ().height () > resolution / 3)
     return;
 
+  if (cluster_budget_spent ()) {
+    cluster_dropped += word->best_choice->string ().length ();
+    return;
+  }
+
   if (tessedit_demo_adaption)
                                  // Make sure not set
     tessedit_display_mm.set_value (FALSE);
@@ -274,6 +292,11 @@ void collect_characters_for_adaption(WERD_RES *word,
   if (word->word->bounding_box ().height () > resolution / 3)
     return;
 
+  if (cluster_budget_spent ()) {
+    cluster_dropped += word->best_choice->string ().length ();
+    return;
+  }
+
   if (tessedit_demo_adaption)
                                  // Make sure not set
     tessedit_display_mm.set_value (FALSE);
@@ -331,6 +354,82 @@ void collect_characters_for_adaption(WERD_RES *word,
 }
 
 
+/**********************************************************************
+ * cluster_budget_spent
+ *
+ * TRUE once the page has used up tessedit_cluster_max_compares.
+ **********************************************************************/
+
+BOOL8 cluster_budget_spent() {
+  return tessedit_cluster_max_compares > 0
+    && cluster_compares >= tessedit_cluster_max_compares;
+}
+
+
+/**********************************************************************
+ * sample_worth_matching
+ *
+ * Decide whether sample should be matched against reference at all,
+ * keeping count of the comparisons made and avoided.
+ **********************************************************************/
+
+BOOL8 sample_worth_matching(CHAR_SAMPLE *reference, CHAR_SAMPLE *sample) {
+  if (tessedit_cluster_prefilter && reference != NULL
+    && !reference->coarse_match (sample, tessedit_cluster_size_ratio)) {
+    cluster_prefiltered++;
+    return FALSE;
+  }
+  if (cluster_budget_spent ()) {
+    cluster_capped++;
+    return FALSE;
+  }
+  cluster_compares++;
+  return TRUE;
+}
+
+
+/**********************************************************************
+ * cluster_worth_matching
+ *
+ * As sample_worth_matching, using the representative of cluster.
+ **********************************************************************/
+
+BOOL8 cluster_worth_matching(CHAR_SAMPLES *cluster, CHAR_SAMPLE *sample) {
+  return sample_worth_matching (cluster->representative (), sample);
+}
+
+
+/**********************************************************************
+ * reset_cluster_stats
+ *
+ * Clear the per-page clustering counters.
+ **********************************************************************/
+
+void reset_cluster_stats() {
+  cluster_compares = 0;
+  cluster_prefiltered = 0;
+  cluster_capped = 0;
+  cluster_dropped = 0;
+}
+
+
+/**********************************************************************
+ * print_cluster_stats
+ *
+ * Report how much clustering work was done and how much was avoided.
+ **********************************************************************/
+
+void print_cluster_stats() {
+  if (!tessedit_cluster_stats && !tessedit_cluster_debug)
+    return;
+  tprintf ("Clustering: " INT32FORMAT " compares, " INT32FORMAT
+    " prefiltered, " INT32FORMAT " over cap, " INT32FORMAT
+    " samples dropped\n",
+    cluster_compares, cluster_prefiltered, cluster_capped,
+    cluster_dropped);
+}
+
+
 void cluster_sample(CHAR_SAMPLE *sample,
                     CHAR_SAMPLES_LIST *char_clusters,
                     CHAR_SAMPLE_LIST *chars_waiting) {
@@ -339,11 +438,19 @@ void cluster_sample(CHAR_SAMPLE *sample,
   CHAR_SAMPLE_IT cw_it = chars_waiting;
   float score;
   float best_score = MAX_INT32;
+  INT32 capped_before;           //cap count at start
 
   if (c_it.empty ())
     c_it.add_to_end (new CHAR_SAMPLES (sample));
+  else if (cluster_budget_spent ()) {
+    cluster_dropped++;
+    delete sample;
+  }
   else {
+    capped_before = cluster_capped;
     for (c_it.mark_cycle_pt (); !c_it.cycled_list (); c_it.forward ()) {
+      if (!cluster_worth_matching (c_it.data (), sample))
+        continue;
       score = c_it.data ()->match_score (sample);
       if (score < best_score) {
         best_score = score;
@@ -354,7 +461,16 @@ void cluster_sample(CHAR_SAMPLE *sample,
     if (tessedit_cluster_debug)
       tprintf ("Sample's best score %f\n", best_score);
 
-    if (best_score < tessedit_cluster_t1) {
+    if (cluster_capped > capped_before) {
+                                 //not compared with every cluster
+      cluster_dropped++;
+      delete sample;
+      #ifndef SECURE_NAMES
+      if (tessedit_cluster_debug)
+        tprintf ("Sample dropped, compare cap reached\n");
+      #endif
+    }
+    else if (best_score < tessedit_cluster_t1) {
       if (best_score > tessedit_cluster_t3 || tessedit_mm_use_prototypes) {
         best_cluster->add_sample (sample);
         check_wait_list(chars_waiting, sample, best_cluster);
@@ -407,13 +523,23 @@ void check_wait_list(CHAR_SAMPLE_LIST *chars_waiting,
         best_cluster->add_sample (test_sample);
       }
 
+      //Without prototypes every pass scores against the same sample,
+      //so only the first pass can move anything
+      if (!tessedit_mm_use_prototypes && test_sample != sample)
+        continue;
       for (cw_it.mark_cycle_pt ();
       !cw_it.cycled_list (); cw_it.forward ()) {
         wait_sample = cw_it.data ();
-        if (tessedit_mm_use_prototypes)
+        if (tessedit_mm_use_prototypes) {
+          if (!cluster_worth_matching (best_cluster, wait_sample))
+            continue;
           score = best_cluster->match_score (wait_sample);
-        else
+        }
+        else {
+          if (!sample_worth_matching (sample, wait_sample))
+            continue;
           score = sample->match_sample (wait_sample, FALSE);
+        }
         if (score < tessedit_cluster_t1) {
           if (score > tessedit_cluster_t3
           || tessedit_mm_use_prototypes) {
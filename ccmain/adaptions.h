@@ -39,6 +39,14 @@ extern INT_VAR_H (tessedit_cluster_min_size, 3,
 "Smallest number of samples in a cluster for it to be used for adaption");
 extern BOOL_VAR_H (tessedit_cluster_debug, FALSE,
 "Generate and print debug information for adaption by clustering");
+extern BOOL_VAR_H (tessedit_cluster_prefilter, TRUE,
+"Skip clusters whose first sample differs grossly in size or ink");
+extern double_VAR_H (tessedit_cluster_size_ratio, 2.0,
+"Largest size or ink ratio between a sample and a cluster worth matching");
+extern INT_VAR_H (tessedit_cluster_max_compares, 0,
+"Most sample comparisons made while clustering a page (0 = no limit)");
+extern BOOL_VAR_H (tessedit_cluster_stats, FALSE,
+"Print a per-page summary of clustering work done and avoided");
 extern BOOL_VAR_H (tessedit_use_best_sample, FALSE,
 "Use best sample from cluster when adapting");
 extern BOOL_VAR_H (tessedit_test_cluster_input, FALSE,
@@ -77,6 +85,11 @@ void collect_ems_for_adaption(WERD_RES *word,
 void collect_characters_for_adaption(WERD_RES *word,
                                      CHAR_SAMPLES_LIST *char_clusters,
                                      CHAR_SAMPLE_LIST *chars_waiting);
+BOOL8 cluster_budget_spent();
+BOOL8 sample_worth_matching(CHAR_SAMPLE *reference, CHAR_SAMPLE *sample);
+BOOL8 cluster_worth_matching(CHAR_SAMPLES *cluster, CHAR_SAMPLE *sample);
+void reset_cluster_stats();
+void print_cluster_stats();
 void cluster_sample(CHAR_SAMPLE *sample,
                     CHAR_SAMPLES_LIST *char_clusters,
                     CHAR_SAMPLE_LIST *chars_waiting);
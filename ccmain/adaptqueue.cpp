@@ -0,0 +1,99 @@
+/**********************************************************************
+ * File:        adaptqueue.cpp
+ * Description: Queue of pass 1 adaptions awaiting publication.
+ * Created:     Sun Oct 18 11:40:12 PDT 2026
+ *
+ ** Licensed under the Apache License, Version 2.0 (the "License");
+ ** you may not use this file except in compliance with the License.
+ ** You may obtain a copy of the License at
+ ** http://www.apache.org/licenses/LICENSE-2.0
+ ** Unless required by applicable law or agreed to in writing, software
+ ** distributed under the License is distributed on an "AS IS" BASIS,
+ ** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ ** See the License for the specific language governing permissions and
+ ** limitations under the License.
+ *
+ **********************************************************************/
+
+#include "mfcpch.h"
+#include          "tfacep.h"
+#include          "tstruct.h"
+#include          "blobs.h"
+#include          "adaptqueue.h"
+
+#define EXTERN
+
+EXTERN INT_VAR (tessedit_adapt_publish, ADAPT_PUBLISH_WORD,
+"When pass 1 adaptions reach the templates: 0=word, 1=row, 2=block, 3=pass");
+
+ELISTIZE (ADAPT_EVENT)
+                                 //awaiting publication
+static ADAPT_EVENT_LIST pending_adaptions;
+
+/**********************************************************************
+ * ADAPT_EVENT::~ADAPT_EVENT
+ **********************************************************************/
+
+ADAPT_EVENT::~ADAPT_EVENT () {
+  if (tessword != NULL)
+    delete_word(tessword);
+}
+
+
+/**********************************************************************
+ * queue_adaption
+ *
+ * Find the adaption thresholds for the word now and keep a copy of it
+ * to adapt to at the next publication point. Until then classification
+ * goes on against the templates as they were at the last publication,
+ * so the results depend only on tessedit_adapt_publish, not on when
+ * the templates happen to be updated.
+ **********************************************************************/
+
+void queue_adaption(                         //defer adaption
+                    WERD *word,              //bln word
+                    DENORM *denorm,          //de-normalise
+                    const char *string,      //string for word
+                    const char *raw_string,  //before context
+                    const char *rejmap       //reject map
+                   ) {
+  ADAPT_EVENT_IT it = &pending_adaptions;
+  ADAPT_EVENT *event;            //new event
+
+  event = new ADAPT_EVENT;
+                                 //make dummy row
+  make_tess_row(denorm, &event->tessrow);
+  event->tessword = make_tess_word (word, &event->tessrow);
+  if (!GetWordAdaptThresholds (event->tessword, &event->tessrow,
+  string, raw_string, event->thresholds)) {
+    delete event;                //not learning
+    return;
+  }
+  event->choice = string;
+  event->use_rejmap = rejmap != NULL;
+  if (rejmap != NULL)
+    event->rejmap = rejmap;
+  it.add_to_end (event);
+}
+
+
+/**********************************************************************
+ * publish_adaptions
+ *
+ * Apply all queued adaptions to the templates, in the order in which
+ * the words were recognized.
+ **********************************************************************/
+
+void publish_adaptions() {
+  ADAPT_EVENT_IT it = &pending_adaptions;
+  ADAPT_EVENT *event;            //current event
+
+  for (it.mark_cycle_pt (); !it.cycled_list (); it.forward ()) {
+    event = it.data ();
+    AdaptToWordWithThresholds (event->tessword, &event->tessrow,
+      event->choice.string (),
+      event->use_rejmap ? event->rejmap.string () : NULL,
+      event->thresholds);
+  }
+  pending_adaptions.clear ();
+}
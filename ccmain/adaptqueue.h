@@ -0,0 +1,73 @@
+/**********************************************************************
+ * File:        adaptqueue.h
+ * Description: Queue of pass 1 adaptions awaiting publication.
+ * Created:     Sun Oct 18 11:40:12 PDT 2026
+ *
+ ** Licensed under the Apache License, Version 2.0 (the "License");
+ ** you may not use this file except in compliance with the License.
+ ** You may obtain a copy of the License at
+ ** http://www.apache.org/licenses/LICENSE-2.0
+ ** Unless required by applicable law or agreed to in writing, software
+ ** distributed under the License is distributed on an "AS IS" BASIS,
+ ** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ ** See the License for the specific language governing permissions and
+ ** limitations under the License.
+ *
+ **********************************************************************/
+
+#ifndef           ADAPTQUEUE_H
+#define           ADAPTQUEUE_H
+
+#include          "varable.h"
+#include          "elst.h"
+#include          "strngs.h"
+#include          "werd.h"
+#include          "tessclas.h"
+#include          "adaptmatch.h"
+#include          "memry.h"
+#include          "notdll.h"
+
+#define ADAPT_PUBLISH_WORD  0    //publication points
+#define ADAPT_PUBLISH_ROW   1
+#define ADAPT_PUBLISH_BLOCK 2
+#define ADAPT_PUBLISH_PASS  3
+
+extern INT_VAR_H (tessedit_adapt_publish, ADAPT_PUBLISH_WORD,
+"When pass 1 adaptions reach the templates: 0=word, 1=row, 2=block, 3=pass");
+
+/**********************************************************************
+ * ADAPT_EVENT
+ *
+ * One word to be adapted to. The thresholds are found when the event
+ * is queued, as they depend on the state of the stopper for the word
+ * just recognized; only the template updates are deferred.
+ **********************************************************************/
+
+class ADAPT_EVENT:public ELIST_LINK
+{
+  public:
+    ADAPT_EVENT() {  //for elist only
+      tessword = NULL;
+    }
+    ~ADAPT_EVENT ();
+
+    TWERD *tessword;             //word to adapt to
+    TEXTROW tessrow;             //row tessword points to
+    STRING choice;               //best choice
+    STRING rejmap;               //chars to adapt to
+    BOOL8 use_rejmap;            //rejmap is valid
+                                 //per char thresholds
+    FLOAT32 thresholds[MAX_ADAPTABLE_WERD_SIZE];
+
+    NEWDELETE2 (ADAPT_EVENT)
+};
+
+ELISTIZEH (ADAPT_EVENT)
+void queue_adaption(                         //defer adaption
+                    WERD *word,              //bln word
+                    DENORM *denorm,          //de-normalise
+                    const char *string,      //string for word
+                    const char *raw_string,  //before context
+                    const char *rejmap);
+void publish_adaptions();
+#endif
@@ -27,6 +27,7 @@
 #include "pgedit.h"
 #include "varabled.h"
 #include "adaptmatch.h"
+#include "wordcache.h"
 
 BOOL_VAR(tessedit_resegment_from_boxes, FALSE,
          "Take segmentation and labeling from box file");
@@ -84,7 +85,8 @@ char* TessBaseAPI::TesseractRect(const UINT8* imagedata,
 }
 
 // Call between pages or documents etc to free up memory and forget
-// adaptive data.
+// adaptive data. The word result cache is kept so that later pages can
+// reuse it; End clears it.
 void TessBaseAPI::ClearAdaptiveClassifier() {
   ResetAdaptiveClassifier();
 }
@@ -92,6 +94,7 @@ void TessBaseAPI::ClearAdaptiveClassifier() {
 // Close down tesseract and free up memory.
 void TessBaseAPI::End() {
   ResetAdaptiveClassifier();
+  clear_word_cache();
   end_tesseract();
 }
 
@@ -44,7 +44,9 @@ class TessBaseAPI {
   // If numeric_mode is true, only possible digits and roman numbers are
   // returned. Returns 0 if successful. Crashes if not.
   // The argc and argv may be 0 and NULL respectively. They are used for
-  // providing config files for debug/display purposes.
+  // providing config files for debug/display purposes. A config file may
+  // also be a binary snapshot, as written by tessedit_write_snapshot, which
+  // is applied with one assignment per variable and no text parsing.
   // TODO(rays) get the facts straight. Is it OK to call
   // it more than once? Make it properly check for errors and return them.
   static int Init(const char* datapath, const char* outputbase,
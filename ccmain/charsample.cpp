@@ -46,6 +46,7 @@ ELISTIZE (CHAR_SAMPLE) ELISTIZE (CHAR_SAMPLES) CHAR_SAMPLE::CHAR_SAMPLE () {
   n_samples_matched = 0;
   total_match_scores = 0.0;
   sumsq_match_scores = 0.0;
+  find_extent();
 }
 
 
@@ -57,6 +58,7 @@ CHAR_SAMPLE::CHAR_SAMPLE(PBLOB *blob, DENORM *denorm, char c) {
   n_samples_matched = 0;
   total_match_scores = 0.0;
   sumsq_match_scores = 0.0;
+  find_extent();
 }
 
 
@@ -68,6 +70,7 @@ CHAR_SAMPLE::CHAR_SAMPLE(IMAGE *image, char c) {
   n_samples_matched = 0;
   total_match_scores = 0.0;
   sumsq_match_scores = 0.0;
+  find_extent();
 }
 
 
@@ -105,6 +108,62 @@ float CHAR_SAMPLE::match_sample(  // Update match scores
 }
 
 
+/**********************************************************************
+ * CHAR_SAMPLE::find_extent
+ *
+ * Record the size of the sample and, for image samples, the number of
+ * black pixels, so that clustering can discard hopeless comparisons
+ * without running the matcher.
+ **********************************************************************/
+
+void CHAR_SAMPLE::find_extent() {
+  INT32 x;
+  INT32 y;
+
+  sample_width = 0;
+  sample_height = 0;
+  sample_ink = -1;
+  if (sample_image != NULL) {
+    sample_width = sample_image->get_xsize ();
+    sample_height = sample_image->get_ysize ();
+    sample_ink = 0;
+    for (y = 0; y < sample_height; y++)
+      for (x = 0; x < sample_width; x++)
+        if (sample_image->pixel (x, y) == 0)
+          sample_ink++;
+  }
+  else if (sample_blob != NULL) {
+    BOX box = sample_blob->bounding_box ();
+
+    sample_width = box.width ();
+    sample_height = box.height ();
+  }
+}
+
+
+/**********************************************************************
+ * CHAR_SAMPLE::coarse_match
+ *
+ * Return FALSE if the two samples differ in width, height or ink by more
+ * than max_ratio, in which case a full match could never succeed.
+ **********************************************************************/
+
+BOOL8 CHAR_SAMPLE::coarse_match(CHAR_SAMPLE *test_sample,
+                                double max_ratio) {
+  INT32 ink2 = test_sample->ink_count ();
+
+  if (sample_width > test_sample->width () * max_ratio
+    || test_sample->width () > sample_width * max_ratio
+    || sample_height > test_sample->height () * max_ratio
+    || test_sample->height () > sample_height * max_ratio)
+    return FALSE;
+  if (sample_ink >= 0 && ink2 >= 0
+    && (sample_ink > ink2 * max_ratio || ink2 > sample_ink * max_ratio))
+    return FALSE;
+  return TRUE;
+}
+
+
 double CHAR_SAMPLE::mean_score() { 
   if (n_samples_matched > 0)
     return (total_match_scores / n_samples_matched);
@@ -150,6 +209,7 @@ CHAR_SAMPLES::CHAR_SAMPLES() {
   samples.clear ();
   ch = '\0';
   best_sample = NULL;
+  rep_sample = NULL;
   proto = NULL;
 }
 
@@ -171,6 +231,7 @@ CHAR_SAMPLES::CHAR_SAMPLES(CHAR_SAMPLE *sample) {
   else
     ch = '\0';
   best_sample = NULL;
+  rep_sample = sample;
   proto = NULL;
 }
 
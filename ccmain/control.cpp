@@ -38,6 +38,8 @@
 #include          "pgedit.h"
 #include          "reject.h"
 #include          "adaptions.h"
+#include          "wordcache.h"
+#include          "adaptqueue.h"
 #include          "charcut.h"
 #include          "fixxht.h"
 #include          "fixspace.h"
@@ -143,6 +145,17 @@ EXTERN BOOL_VAR (tessedit_matcher_log, FALSE, "Log matcher activity");
 EXTERN INT_VAR (tessedit_test_adaption_mode, 3,
 "Adaptation decision algorithm for tess");
 
+EXTERN BOOL_VAR (tessedit_pass2_skip, FALSE,
+"Keep confident pass 1 dictionary words without pass 2 x-ht rework");
+EXTERN double_VAR (tessedit_pass2_skip_certainty, -1.0,
+"Worst pass 1 certainty for a word to skip pass 2");
+EXTERN double_VAR (tessedit_pass2_skip_xht_band, 0.5,
+"Fraction of bln x-ht by which word top may miss a standard height");
+EXTERN BOOL_VAR (tessedit_pass2_skip_verify, FALSE,
+"Run pass 2 anyway on skippable words and count changed results");
+EXTERN BOOL_VAR (tessedit_pass2_skip_stats, FALSE,
+"Print pass 2 skip statistics per page");
+
 EXTERN BOOL_VAR (test_pt, FALSE, "Test for point");
 EXTERN double_VAR (test_pt_x, 99999.99, "xcoord");
 EXTERN double_VAR (test_pt_y, 99999.99, "ycoord");
@@ -162,6 +175,10 @@ extern "C" {
 */
 FILE *choice_file = NULL;        //Choice file ptr
 
+static INT32 pass2_words = 0;    //words seen by pass 2
+static INT32 pass2_skipped = 0;  //words passing the skip gate
+static INT32 pass2_changed = 0;  //skippable words pass 2 altered
+
 CLISTIZEH (PBLOB) CLISTIZE (PBLOB)
 /* DEBUGGING */
 INT16 blob_count(WERD *w) {
@@ -198,7 +215,7 @@ void recog_pseudo_word(                         //recognize blobs
  **********************************************************************/
 
 BOOL8 recog_interactive(            //recognize blobs
-                        BLOCK *,    //block
+                        BLOCK *block,  //block of word
                         ROW *row,   //row of word
                         WERD *word  //word to recognize
                        ) {
@@ -206,7 +223,8 @@ BOOL8 recog_interactive(            //recognize blobs
   INT16 char_qual;
   INT16 good_char_qual;
 
-  classify_word_pass2(&word_res, row);
+  reset_x_ht_model();
+  classify_word_pass2(&word_res, row, block);
   #ifndef SECURE_NAMES
   if (tessedit_debug_quality_metrics) {
     word_char_quality(&word_res, row, &char_qual, &good_char_qual);
@@ -220,6 +238,39 @@ BOOL8 recog_interactive(            //recognize blobs
 }
 
 
+/**********************************************************************
+ * block_in_page_frame
+ *
+ * Cluster and em adaption and the nn matcher clip character samples out
+ * of page_image with the word boxes, so they can only be used on blocks
+ * that textord did not turn upright.
+ **********************************************************************/
+
+BOOL8 block_in_page_frame(               //can clip page_image?
+                          BLOCK *block   //block of word
+                         ) {
+  return block->rotation ().y () == 0.0f;
+}
+
+
+/**********************************************************************
+ * publish_if_due
+ *
+ * Publish queued adaptions when the word at page_res_it is the last of
+ * its row or block and tessedit_adapt_publish asks for that.
+ **********************************************************************/
+
+static void publish_if_due(                           //end of row/block?
+                           PAGE_RES_IT &page_res_it   //current word
+                          ) {
+  if ((tessedit_adapt_publish == ADAPT_PUBLISH_ROW
+    && page_res_it.next_row () != page_res_it.row ())
+    || (tessedit_adapt_publish == ADAPT_PUBLISH_BLOCK
+    && page_res_it.next_block () != page_res_it.block ()))
+    publish_adaptions();
+}
+
+
 /**********************************************************************
  * recog_all_words()
  *
@@ -264,6 +315,10 @@ void recog_all_words(                              //process words
     tessedit_minimal_rejection.set_value (TRUE);
   }
 
+  reset_cluster_stats();
+  pass2_words = 0;
+  pass2_skipped = 0;
+  pass2_changed = 0;
   if (tessedit_cluster_adapt_before_pass1) {
     tess_adapt_mode = tessedit_tess_adaption_mode;
     tessedit_tess_adaption_mode.set_value (0);
@@ -293,11 +348,14 @@ void recog_all_words(                              //process words
       monitor->progress = 30 + 50 * word_index / word_count;
       if ((monitor->end_time != 0 && clock() > monitor->end_time) ||
           (monitor->cancel != NULL && (*monitor->cancel)(monitor->cancel_this,
-                                                         dict_words)))
+                                                         dict_words))) {
+        publish_adaptions();
         return;
+      }
     }
     classify_word_pass1 (page_res_it.word (),
-      page_res_it.row ()->row, FALSE, NULL, NULL);
+      page_res_it.row ()->row, page_res_it.block ()->block,
+      FALSE, NULL, NULL);
 
     if (tessedit_test_adaption && !tessedit_minimal_rejection) {
       if (!word_adaptable (page_res_it.word (),
@@ -320,15 +378,21 @@ void recog_all_words(                              //process words
     if ((tessedit_cluster_adapt_after_pass1
       || tessedit_cluster_adapt_after_pass3
       || tessedit_cluster_adapt_before_pass1)
-    && tessedit_cluster_adaption_mode != 0) {
+      && tessedit_cluster_adaption_mode != 0
+    && block_in_page_frame (page_res_it.block ()->block)) {
       collect_characters_for_adaption (page_res_it.word (),
         &char_clusters, &chars_waiting);
     }
     // Count dict words.
     if (page_res_it.word()->best_choice->permuter() == USER_DAWG_PERM)
       ++dict_words;
+    publish_if_due(page_res_it);
     page_res_it.forward ();
   }
+  publish_adaptions();
+
+  if (tessedit_word_cache && tessedit_word_cache_stats)
+    print_word_cache_stats();
 
   if (tessedit_cluster_adapt_before_pass1)
     tessedit_tess_adaption_mode.set_value (tess_adapt_mode);
@@ -339,16 +403,20 @@ void recog_all_words(                              //process words
   && page_res_it.word () != NULL) {
     if (monitor != NULL)
       monitor->ocr_alive = TRUE;
-    if (tessedit_cluster_adapt_after_pass1)
-      adapt_to_good_samples (page_res_it.word (),
-        &char_clusters, &chars_waiting);
-    else
-      classify_word_pass1 (page_res_it.word (),
-        page_res_it.row ()->row,
-        TRUE, &char_clusters, &chars_waiting);
+    if (block_in_page_frame (page_res_it.block ()->block)) {
+      if (tessedit_cluster_adapt_after_pass1)
+        adapt_to_good_samples (page_res_it.word (),
+          &char_clusters, &chars_waiting);
+      else
+        classify_word_pass1 (page_res_it.word (),
+          page_res_it.row ()->row, page_res_it.block ()->block,
+          TRUE, &char_clusters, &chars_waiting);
+    }
+    publish_if_due(page_res_it);
 
     page_res_it.forward ();
   }
+  publish_adaptions();
 
   /* Pass 2 */
   page_res_it.restart_page ();
@@ -364,19 +432,32 @@ void recog_all_words(                              //process words
                                                          dict_words)))
         return;
     }
-    classify_word_pass2 (page_res_it.word (), page_res_it.row ()->row);
+    if (page_res_it.block () != page_res_it.prev_block ())
+      reset_x_ht_model();
+    classify_word_pass2 (page_res_it.word (), page_res_it.row ()->row,
+      page_res_it.block ()->block);
 
-    if (tessedit_em_adaption_mode > 0)
+    if (tessedit_em_adaption_mode > 0
+      && block_in_page_frame (page_res_it.block ()->block))
       collect_ems_for_adaption (page_res_it.word (),
         &em_clusters, &ems_waiting);
 
     if (tessedit_cluster_adapt_after_pass2
-      && tessedit_cluster_adaption_mode != 0)
+      && tessedit_cluster_adaption_mode != 0
+      && block_in_page_frame (page_res_it.block ()->block))
       collect_characters_for_adaption (page_res_it.word (),
         &char_clusters, &chars_waiting);
     page_res_it.forward ();
   }
 
+  if (tessedit_pass2_skip_stats) {
+    tprintf ("Pass 2: " INT32FORMAT " words, " INT32FORMAT " skippable",
+      pass2_words, pass2_skipped);
+    if (tessedit_pass2_skip_verify)
+      tprintf (", " INT32FORMAT " of them changed by pass 2", pass2_changed);
+    tprintf ("\n");
+  }
+
   /* Another pass */
   set_global_loc_code(LOC_FUZZY_SPACE);
 
@@ -401,11 +482,13 @@ void recog_all_words(                              //process words
     check_debug_pt (page_res_it.word (), 70);
     /* Use good matches to sort out confusions */
 
-    if (tessedit_em_adaption_mode != 0)
+    if (tessedit_em_adaption_mode != 0
+      && block_in_page_frame (page_res_it.block ()->block))
       adapt_to_good_ems (page_res_it.word (), &em_clusters, &ems_waiting);
 
     if (tessedit_cluster_adapt_after_pass2
-      && tessedit_cluster_adaption_mode != 0)
+      && tessedit_cluster_adaption_mode != 0
+      && block_in_page_frame (page_res_it.block ()->block))
       adapt_to_good_samples (page_res_it.word (),
         &char_clusters, &chars_waiting);
 
@@ -451,11 +534,14 @@ void recog_all_words(                              //process words
   && tessedit_cluster_adapt_after_pass3 && page_res_it.word () != NULL) {
     if (monitor != NULL)
       monitor->ocr_alive = TRUE;
-    if (tessedit_cluster_adaption_mode != 0)
+    if (tessedit_cluster_adaption_mode != 0
+      && block_in_page_frame (page_res_it.block ()->block))
       adapt_to_good_samples (page_res_it.word (),
         &char_clusters, &chars_waiting);
     page_res_it.forward ();
   }
+  if (tessedit_cluster_adaption_mode != 0)
+    print_cluster_stats();
 
   #ifndef SECURE_NAMES
   if (tessedit_debug_quality_metrics) {
@@ -485,6 +571,7 @@ void recog_all_words(                              //process words
     quality_based_rejection(page_res_it, good_quality_doc);
   }
   font_recognition_pass(page_res_it);
+  print_tprintf_counters();
 
   /* Write results pass */
   set_global_loc_code(LOC_WRITE_RESULTS);
@@ -503,6 +590,7 @@ void recog_all_words(                              //process words
 void classify_word_pass1(                 //recog one word
                          WERD_RES *word,  //word to do
                          ROW *row,
+                         BLOCK *block,
                          BOOL8 cluster_adapt,
                          CHAR_SAMPLES_LIST *char_clusters,
                          CHAR_SAMPLE_LIST *chars_waiting) {
@@ -534,6 +622,19 @@ void classify_word_pass1(                 //recog one word
   matcher_pass = 0;
   bln_word = make_bln_copy (word->word, row, row->x_height (), &word->denorm);
 
+  if (tessedit_word_cache && !cluster_adapt && matcher_fp == NULL
+  && word_cache_lookup (word, row)) {
+    record_certainty (word->best_choice->certainty (), 1);
+    if (tessedit_enable_doc_dict && !word->tess_failed)
+      tess_add_doc_word (word->best_choice);
+    if (tessedit_print_text) {
+      write_cooked_text (bln_word, NULL, word->best_choice->string (),
+        word->done, FALSE, stdout);
+    }
+    delete bln_word;
+    return;
+  }
+
   word->best_choice = tess_segment_pass1 (bln_word, &word->denorm,
     tess_default_matcher,
     word->raw_choice, &blob_choices,
@@ -598,7 +699,7 @@ void classify_word_pass1(                 //recog one word
         word->best_choice,
         word->raw_choice);
                                  // Also sets word->done flag
-      make_reject_map (word, &blob_choices, row, 1);
+      make_reject_map (word, &blob_choices, row, block, 1);
 
       adapt_ok = word_adaptable (word, tessedit_tess_adaption_mode);
 
@@ -622,16 +723,21 @@ void classify_word_pass1(                 //recog one word
         }
 
                                  //adapt to it
-        tess_adapter (word->outword, &word->denorm, word->best_choice->string ().string (), word->raw_choice->string ().string (), rejmap);
+        if (tessedit_adapt_publish == ADAPT_PUBLISH_WORD)
+          tess_adapter (word->outword, &word->denorm, word->best_choice->string ().string (), word->raw_choice->string ().string (), rejmap);
+        else
+          queue_adaption (word->outword, &word->denorm, word->best_choice->string ().string (), word->raw_choice->string ().string (), rejmap);
       }
 
       if (tessedit_enable_doc_dict)
         tess_add_doc_word (word->best_choice);
       set_word_fonts(word, &blob_choices);
+      if (tessedit_word_cache && !cluster_adapt && matcher_fp == NULL)
+        word_cache_store(word, row);
     }
   }
   if (tessedit_print_text) {
-    write_cooked_text (bln_word, word->best_choice->string (),
+    write_cooked_text (bln_word, NULL, word->best_choice->string (),
       word->done, FALSE, stdout);
   }
   delete bln_word;
@@ -639,6 +745,42 @@ void classify_word_pass1(                 //recog one word
 }
 
 
+/**********************************************************************
+ * pass2_skippable
+ *
+ * Decide whether the pass 1 result is good enough to keep as it is.
+ * The word must be done, free of rejects, a dictionary word with a
+ * certainty no worse than tessedit_pass2_skip_certainty, and accepted
+ * by the stopper (which covers dangerous ambiguities). The height of the
+ * baseline normalised word above its baseline must also lie between
+ * about the x-height and the caps height, otherwise the row x-height
+ * may be wrong for it.
+ **********************************************************************/
+
+BOOL8 pass2_skippable(                 //can skip pass 2?
+                      WERD_RES *word   //word to check
+                     ) {
+  UINT8 permuter;                //pass 1 permuter
+  float top;                     //top above baseline
+  float band;                    //allowed x-ht error
+
+  if (!word->done || word->tess_failed || !word->tess_accepted
+    || word->word->flag (W_REP_CHAR) || word->outword == NULL
+    || word->reject_map.reject_count () > 0)
+    return FALSE;
+  permuter = word->best_choice->permuter ();
+  if (permuter != SYSTEM_DAWG_PERM && permuter != FREQ_DAWG_PERM
+    && permuter != USER_DAWG_PERM)
+    return FALSE;
+  if (word->best_choice->certainty () < tessedit_pass2_skip_certainty)
+    return FALSE;
+  top = word->outword->bounding_box ().top () - bln_baseline_offset;
+  band = bln_x_height * tessedit_pass2_skip_xht_band;
+  return top >= bln_x_height - band
+    && top <= bln_x_height / x_ht_fraction_of_caps_ht + band;
+}
+
+
 /**********************************************************************
  * classify_word_pass2
  *
@@ -647,7 +789,8 @@ void classify_word_pass1(                 //recog one word
 
 void classify_word_pass2(  //word to do
                          WERD_RES *word,
-                         ROW *row) {
+                         ROW *row,
+                         BLOCK *block) {
   BOOL8 done_this_pass = FALSE;
   WERD_RES new_x_ht_word (word->word);
   float new_x_ht = 0.0;
@@ -661,9 +804,21 @@ void classify_word_pass2(  //word to do
   INT16 old_word_quality;
   INT16 new_word_quality;
   INT16 dummy;
+  BOOL8 skippable;               //passed the skip gate
+  STRING pass1_string;           //for verification
 
   set_global_subloc_code(SUBLOC_NORM);
   check_debug_pt (word, 30);
+  pass2_words++;
+  skippable = tessedit_pass2_skip && !tessedit_training_tess
+    && !tessedit_training_wiseowl && !tessedit_dump_choices
+    && pass2_skippable (word);
+  if (skippable) {
+    pass2_skipped++;
+    pass1_string = word->best_choice->string ();
+    if (tessedit_pass2_skip_verify)
+      skippable = FALSE;         //do the work but keep count
+  }
   if (!word->done ||
     tessedit_training_tess ||
   tessedit_training_wiseowl || tessedit_dump_choices) {
@@ -674,12 +829,14 @@ void classify_word_pass2(  //word to do
       delete word->best_choice;
       delete word->raw_choice;
     }
-    match_word_pass2 (word, row, row->x_height ());
+    match_word_pass2 (word, row, block, row->x_height ());
     done_this_pass = TRUE;
     check_debug_pt (word, 40);
   }
 
-  if (!word->tess_failed && !word->word->flag (W_REP_CHAR)) {
+  if (skippable)
+    record_certainty (word->best_choice->certainty (), 2);
+  else if (!word->tess_failed && !word->word->flag (W_REP_CHAR)) {
     set_global_subloc_code(SUBLOC_FIX_XHT);
     if ((tessedit_xht_fiddles_on_done_wds || !word->done) &&
       (tessedit_xht_fiddles_on_no_rej_wds ||
@@ -687,8 +844,17 @@ void classify_word_pass2(  //word to do
       if ((x_ht_check_word_occ >= 2) && word_occ_first)
         check_block_occ(word);
 
-      if (tessedit_redo_xheight)
+      if (tessedit_redo_xheight) {
         re_estimate_x_ht(word, &new_x_ht);
+        add_to_x_ht_model(word, row);
+        if (new_x_ht > 0 && word->guessed_x_ht && x_ht_use_block_model
+        && x_ht_model_consistent ()) {
+          if (debug_x_ht_level >= 1)
+            tprintf ("Block xht model skips rematch of %s at %f\n",
+              word->best_choice->string ().string (), new_x_ht);
+          new_x_ht = 0.0;        //trial xht not worth it
+        }
+      }
 
       if (((x_ht_check_word_occ >= 2) && !word_occ_first) ||
         ((x_ht_check_word_occ >= 1) && (new_x_ht > 0)))
@@ -700,7 +866,8 @@ void classify_word_pass2(  //word to do
       /* Re-estimated x_ht error suggests a rematch is worthwhile. */
       new_x_ht_word.x_height = new_x_ht;
       new_x_ht_word.caps_height = 0.0;
-      match_word_pass2 (&new_x_ht_word, row, new_x_ht_word.x_height);
+      match_word_pass2 (&new_x_ht_word, row, block,
+        new_x_ht_word.x_height);
       if (!new_x_ht_word.tess_failed) {
         if ((x_ht_check_word_occ >= 1) && word_occ_first)
           check_block_occ(&new_x_ht_word);
@@ -817,9 +984,12 @@ void classify_word_pass2(  //word to do
 
   set_global_subloc_code(SUBLOC_NORM);
   if (tessedit_print_text) {
-    write_cooked_text (word->outword, word->best_choice->string (),
+    write_cooked_text (word->outword, NULL, word->best_choice->string (),
       word->done, done_this_pass, stdout);
   }
+  if (pass1_string.length () > 0
+    && pass1_string != word->best_choice->string ())
+    pass2_changed++;
   check_debug_pt (word, 50);
 }
 
@@ -833,6 +1003,7 @@ void classify_word_pass2(  //word to do
 void match_word_pass2(                 //recog one word
                       WERD_RES *word,  //word to do
                       ROW *row,
+                      BLOCK *block,
                       float x_height) {
   WERD *bln_word;                //baseline norm copy
                                  //detailed results
@@ -936,7 +1107,7 @@ void match_word_pass2(                 //recog one word
       word->tess_accepted = tess_acceptable_word (word->best_choice,
         word->raw_choice);
 
-      make_reject_map (word, &blob_choices, row, 2);
+      make_reject_map (word, &blob_choices, row, block, 2);
     }
   }
   blob_choices.deep_clear ();
@@ -1625,10 +1796,10 @@ void add_in_one_row(               //good chars in word
                     INT8 *bold     //output count
                    ) {
   WERD_RES *word;                //current word
-  WERD_RES_IT word_it = &row->word_res_list;
+  INT32 word_index;              //index in row
 
-  for (word_it.mark_cycle_pt (); !word_it.cycled_list (); word_it.forward ()) {
-    word = word_it.data ();
+  for (word_index = 0; word_index < row->word_count; word_index++) {
+    word = row->word (word_index);
     *italic += word->italic;
     *bold += word->bold;
     if (word->font1_count > 0)
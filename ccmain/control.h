@@ -121,6 +121,16 @@ extern BOOL_VAR_H (tessedit_global_adaption, FALSE,
 extern BOOL_VAR_H (tessedit_matcher_log, FALSE, "Log matcher activity");
 extern INT_VAR_H (tessedit_test_adaption_mode, 3,
 "Adaptation decision algorithm for tess");
+extern BOOL_VAR_H (tessedit_pass2_skip, FALSE,
+"Keep confident pass 1 dictionary words without pass 2 x-ht rework");
+extern double_VAR_H (tessedit_pass2_skip_certainty, -1.0,
+"Worst pass 1 certainty for a word to skip pass 2");
+extern double_VAR_H (tessedit_pass2_skip_xht_band, 0.5,
+"Fraction of bln x-ht by which word top may miss a standard height");
+extern BOOL_VAR_H (tessedit_pass2_skip_verify, FALSE,
+"Run pass 2 anyway on skippable words and count changed results");
+extern BOOL_VAR_H (tessedit_pass2_skip_stats, FALSE,
+"Print pass 2 skip statistics per page");
 extern BOOL_VAR_H (test_pt, FALSE, "Test for point");
 extern double_VAR_H (test_pt_x, 99999.99, "xcoord");
 extern double_VAR_H (test_pt_y, 99999.99, "ycoord");
@@ -136,17 +146,25 @@ void recog_all_words(                              //process words
                      PAGE_RES *page_res,           //page structure
                      volatile ETEXT_DESC *monitor  //progress monitor
                     );
+BOOL8 block_in_page_frame(               //can clip page_image?
+                          BLOCK *block   //block of word
+                         );
 void classify_word_pass1(                 //recog one word
                          WERD_RES *word,  //word to do
                          ROW *row,
+                         BLOCK *block,
                          BOOL8 cluster_adapt,
                          CHAR_SAMPLES_LIST *char_clusters,
                          CHAR_SAMPLE_LIST *chars_waiting);
                                  //word to do
-void classify_word_pass2(WERD_RES *word, ROW *row); 
+BOOL8 pass2_skippable(                 //can skip pass 2?
+                      WERD_RES *word   //word to check
+                     );
+void classify_word_pass2(WERD_RES *word, ROW *row, BLOCK *block);
 void match_word_pass2(                 //recog one word
                       WERD_RES *word,  //word to do
                       ROW *row,
+                      BLOCK *block,
                       float x_height);
 void fix_rep_char(                //Repeated char word
                   WERD_RES *word  //word to do
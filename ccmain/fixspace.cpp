@@ -92,7 +92,8 @@ void fix_fuzzy_spaces(                               //find fuzzy words
           word->flag (W_FUZZY_NON) ||
           word_res_it_from.data_relative (1)->
         word->flag (W_FUZZY_SP))) {
-          fix_sp_fp_word (word_res_it_from, row_res_it.data ()->row);
+          fix_sp_fp_word (word_res_it_from, row_res_it.data ()->row,
+            block_res_it.data ()->block);
           word_res = word_res_it_from.forward ();
           word_index++;
           if (monitor != NULL) {
@@ -134,7 +135,8 @@ void fix_fuzzy_spaces(                               //find fuzzy words
             fuzzy_space_words.assign_to_sublist (&word_res_it_from,
               &word_res_it_to);
             fix_fuzzy_space_list (fuzzy_space_words,
-              row_res_it.data ()->row);
+              row_res_it.data ()->row,
+              block_res_it.data ()->block);
             new_length = fuzzy_space_words.length ();
             word_res_it_from.add_list_before (&fuzzy_space_words);
             for (;
@@ -146,9 +148,12 @@ void fix_fuzzy_spaces(                               //find fuzzy words
           if (test_pt)
             debug_fix_space_level.set_value (0);
         }
-        fix_sp_fp_word (word_res_it_from, row_res_it.data ()->row);
+        fix_sp_fp_word (word_res_it_from, row_res_it.data ()->row,
+          block_res_it.data ()->block);
         //Last word in row
       }
+                                 //words have changed
+      row_res_it.data ()->index_words ();
     }
   }
 }
@@ -156,7 +161,8 @@ void fix_fuzzy_spaces(                               //find fuzzy words
 
 void fix_fuzzy_space_list(  //space explorer
                           WERD_RES_LIST &best_perm,
-                          ROW *row) {
+                          ROW *row,
+                          BLOCK *block) {
   INT16 best_score;
   WERD_RES_LIST current_perm;
   INT16 current_score;
@@ -171,7 +177,7 @@ void fix_fuzzy_space_list(  //space explorer
     initialise_search(best_perm, current_perm); 
 
   while ((best_score != PERFECT_WERDS) && !current_perm.empty ()) {
-    match_current_words(current_perm, row); 
+    match_current_words(current_perm, row, block);
     current_score = eval_word_spacing (current_perm);
     dump_words (current_perm, current_score, 2, improved);
     if (current_score > best_score) {
@@ -205,14 +211,14 @@ void initialise_search(WERD_RES_LIST &src_list, WERD_RES_LIST &new_list) {
 }
 
 
-void match_current_words(WERD_RES_LIST &words, ROW *row) { 
+void match_current_words(WERD_RES_LIST &words, ROW *row, BLOCK *block) {
   WERD_RES_IT word_it(&words); 
   WERD_RES *word;
 
   for (word_it.mark_cycle_pt (); !word_it.cycled_list (); word_it.forward ()) {
     word = word_it.data ();
     if ((!word->part_of_combo) && (word->outword == NULL))
-      classify_word_pass2(word, row); 
+      classify_word_pass2(word, row, block);
   }
 }
 
@@ -627,7 +633,7 @@ BOOL8 fixspace_thinks_word_done(WERD_RES *word) {
  * Return with the iterator pointing to the same place if the word is unchanged,
  * or the last of the replacement words.
  *************************************************************************/
-void fix_sp_fp_word(WERD_RES_IT &word_res_it, ROW *row) { 
+void fix_sp_fp_word(WERD_RES_IT &word_res_it, ROW *row, BLOCK *block) {
   WERD_RES *word_res;
   WERD_RES_LIST sub_word_list;
   WERD_RES_IT sub_word_list_it(&sub_word_list); 
@@ -654,7 +660,7 @@ void fix_sp_fp_word(WERD_RES_IT &word_res_it, ROW *row) {
   #endif
   gblob_sort_list ((PBLOB_LIST *) word_res->word->rej_cblob_list (), FALSE);
   sub_word_list_it.add_after_stay_put (word_res_it.extract ());
-  fix_noisy_space_list(sub_word_list, row); 
+  fix_noisy_space_list(sub_word_list, row, block);
   new_length = sub_word_list.length ();
   word_res_it.add_list_before (&sub_word_list);
   for (; (!word_res_it.at_last () && (new_length > 1)); new_length--) {
@@ -663,7 +669,7 @@ void fix_sp_fp_word(WERD_RES_IT &word_res_it, ROW *row) {
 }
 
 
-void fix_noisy_space_list(WERD_RES_LIST &best_perm, ROW *row) { 
+void fix_noisy_space_list(WERD_RES_LIST &best_perm, ROW *row, BLOCK *block) {
   INT16 best_score;
   WERD_RES_IT best_perm_it(&best_perm); 
   WERD_RES_LIST current_perm;
@@ -692,7 +698,7 @@ void fix_noisy_space_list(WERD_RES_LIST &best_perm, ROW *row) {
   break_noisiest_blob_word(current_perm); 
 
   while ((best_score != PERFECT_WERDS) && !current_perm.empty ()) {
-    match_current_words(current_perm, row); 
+    match_current_words(current_perm, row, block);
     current_score = fp_eval_word_spacing (current_perm);
     dump_words (current_perm, current_score, 2, improved);
     if (current_score > best_score) {
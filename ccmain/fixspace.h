@@ -52,9 +52,10 @@ void fix_fuzzy_spaces(                               //find fuzzy words
                       PAGE_RES *page_res);
 void fix_fuzzy_space_list(  //space explorer
                           WERD_RES_LIST &best_perm,
-                          ROW *row);
+                          ROW *row,
+                          BLOCK *block);
 void initialise_search(WERD_RES_LIST &src_list, WERD_RES_LIST &new_list); 
-void match_current_words(WERD_RES_LIST &words, ROW *row); 
+void match_current_words(WERD_RES_LIST &words, ROW *row, BLOCK *block);
 INT16 eval_word_spacing(WERD_RES_LIST &word_res_list); 
 BOOL8 digit_or_numeric_punct(WERD_RES *word, char ch); 
 void transform_to_next_perm(WERD_RES_LIST &words); 
@@ -62,8 +63,8 @@ void dump_words(WERD_RES_LIST &perm, INT16 score, INT16 mode, BOOL8 improved);
 BOOL8 uniformly_spaced(  //sensible word
                        WERD_RES *word);
 BOOL8 fixspace_thinks_word_done(WERD_RES *word); 
-void fix_sp_fp_word(WERD_RES_IT &word_res_it, ROW *row); 
-void fix_noisy_space_list(WERD_RES_LIST &best_perm, ROW *row); 
+void fix_sp_fp_word(WERD_RES_IT &word_res_it, ROW *row, BLOCK *block);
+void fix_noisy_space_list(WERD_RES_LIST &best_perm, ROW *row, BLOCK *block);
 void break_noisiest_blob_word(WERD_RES_LIST &words); 
 INT16 worst_noise_blob(WERD_RES *word_res, float *worst_noise_score); 
 float blob_noise_score(PBLOB *blob); 
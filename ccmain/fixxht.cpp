@@ -47,6 +47,12 @@ EXTERN BOOL_VAR (x_ht_limit_flip_trials, TRUE,
 "Dont do trial flips when ambigs are close to xht?");
 EXTERN BOOL_VAR (rej_use_check_block_occ, TRUE,
 "Analyse rejection behaviour");
+EXTERN BOOL_VAR (x_ht_use_block_model, FALSE,
+"Only rematch guessed xhts that the block model doubts");
+EXTERN INT_VAR (x_ht_model_min_words, 6,
+"Certain xht words in block before model is used");
+EXTERN double_VAR (x_ht_model_band, 0.1,
+"Block model err band as fract of row xht");
 
 EXTERN STRING_VAR (chs_non_ambig_caps_ht,
 "!#$%&()/12346789?ABDEFGHIKLNQRT[]\\bdfhkl",
@@ -74,6 +80,11 @@ EXTERN STRING_VAR (chs_bl,
 "Baseline chars");
 EXTERN STRING_VAR (chs_non_ambig_desc, "gq", "Reliable descender chars");
 
+                                 //block x-ht model
+static INT32 model_words = 0;    //certain words seen
+static double model_sum = 0.0;   //sum of xht/row xht
+static double model_sum_sq = 0.0;//sum of squares
+
 /*************************************************************************
  * re_estimate_x_ht()
  *
@@ -489,6 +500,64 @@ void re_estimate_x_ht(                     //improve for 1 word
 }
 
 
+/*************************************************************************
+ * reset_x_ht_model()
+ *
+ * Start the x-ht model for a new block. Each word is compared with the
+ * textord x-ht of its own row, so the empty model stands for the textord
+ * estimates and it is only used once words have confirmed them.
+ *************************************************************************/
+
+void reset_x_ht_model() {
+  model_words = 0;
+  model_sum = 0.0;
+  model_sum_sq = 0.0;
+}
+
+
+/*************************************************************************
+ * add_to_x_ht_model()
+ *
+ * Add a word to the block model if re_estimate_x_ht found its x-ht from
+ * confirmed characters. It is recorded as a fraction of the row x-ht.
+ *************************************************************************/
+
+void add_to_x_ht_model(                     //note confirmed xht
+                       WERD_RES *word_res,  //word after re_estimate
+                       ROW *row             //row of word
+                      ) {
+  double ratio;                  //word xht/row xht
+
+  if (word_res->guessed_x_ht || row->x_height () <= 0)
+    return;
+  ratio = word_res->x_height / row->x_height ();
+  model_words++;
+  model_sum += ratio;
+  model_sum_sq += ratio * ratio;
+}
+
+
+/*************************************************************************
+ * x_ht_model_consistent()
+ *
+ * TRUE if enough words in the block have confirmed x-hts, and these agree
+ * closely with their row x-hts. A guessed x-ht on another word of the block
+ * is then more likely wrong than the row, so it need not be rematched.
+ *************************************************************************/
+
+BOOL8 x_ht_model_consistent() {
+  double mean;                   //of xht ratios
+  double variance;               //of xht ratios
+
+  if (model_words < x_ht_model_min_words || model_words == 0)
+    return FALSE;
+  mean = model_sum / model_words;
+  variance = model_sum_sq / model_words - mean * mean;
+  return fabs (mean - 1.0) <= x_ht_model_band
+    && variance <= x_ht_model_band * x_ht_model_band;
+}
+
+
 /*************************************************************************
  * check_block_occ()
  * Checks word for coarse block occupancy, rejecting more chars and flipping
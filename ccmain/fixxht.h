@@ -43,6 +43,12 @@ extern BOOL_VAR_H (x_ht_limit_flip_trials, TRUE,
 "Dont do trial flips when ambigs are close to xht?");
 extern BOOL_VAR_H (rej_use_check_block_occ, TRUE,
 "Analyse rejection behaviour");
+extern BOOL_VAR_H (x_ht_use_block_model, FALSE,
+"Only rematch guessed xhts that the block model doubts");
+extern INT_VAR_H (x_ht_model_min_words, 6,
+"Certain xht words in block before model is used");
+extern double_VAR_H (x_ht_model_band, 0.1,
+"Block model err band as fract of row xht");
 extern STRING_VAR_H (chs_non_ambig_caps_ht,
 "!#$%&()/12346789?ABDEFGHIKLNQRT[]\\bdfhkl",
 "Reliable ascenders");
@@ -69,6 +75,12 @@ void re_estimate_x_ht(                     //improve for 1 word
                       WERD_RES *word_res,  //word to do
                       float *trial_x_ht    //new match value
                      );
+void reset_x_ht_model();
+void add_to_x_ht_model(                     //note confirmed xht
+                       WERD_RES *word_res,  //word after re_estimate
+                       ROW *row             //row of word
+                      );
+BOOL8 x_ht_model_consistent();
 void check_block_occ(WERD_RES *word_res); 
 char check_blob_occ(char proposed_char,
                     INT16 blob_ht_above_baseline,
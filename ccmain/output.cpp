@@ -399,11 +399,12 @@ void write_results(                           //output a word
       page_res_it.row (), *wordstr);
 
   if (tessedit_write_output)
-    write_cooked_text (word->word, *wordstr, TRUE, FALSE, textfile);
+    write_cooked_text (word->word, page_res_it.block ()->block, *wordstr,
+      TRUE, FALSE, textfile);
 
   if (tessedit_write_raw_output)
-    write_cooked_text (word->word, word->raw_choice->string (),
-      TRUE, FALSE, rawfile);
+    write_cooked_text (word->word, page_res_it.block ()->block,
+      word->raw_choice->string (), TRUE, FALSE, rawfile);
 
   if (tessedit_write_txt_map)
     write_map(txt_mapfile, word); 
@@ -636,11 +637,13 @@ char determine_newline_type(                   //test line ends
  * write_cooked_text
  *
  * Write the cooked text (with bold for pass2 and underline for reject)
- * to the given file.
+ * to the given file. Word boxes are mapped back to the page if the block
+ * was turned upright by textord.
  **********************************************************************/
 
 void write_cooked_text(                     //write output
                        WERD *word,          //word to do
+                       BLOCK *block,        //block of word or NULL
                        const STRING &text,  //text to write
                        BOOL8 acceptable,    //good stuff
                        BOOL8 pass2,         //done on pass2
@@ -695,6 +698,8 @@ void write_cooked_text(                     //write output
                                  //xiaofan
     if (NO_BLOCK && word && strlen (buff)) {
       mybox = word->bounding_box ();
+      if (block != NULL)
+        block->re_rotate_box (mybox);
       if (newaline || !havespace) {
         fprintf (fp, " ");
         newaline = 0;
@@ -781,6 +786,7 @@ void write_shm_text(                    //write output
     for (index = 0; index < length; index++, blob_it.forward ()) {
       blob = blob_it.data ();
       blob_box = blob->bounding_box ();
+      block->re_rotate_box (blob_box);
 
       enhancement = 0;
       if (word->italic > 0 || word->italic == 0 && row->italic > 0)
@@ -831,6 +837,7 @@ void write_shm_text(                    //write output
     if (blanks == 0 && !word->word->flag (W_BOL))
       blanks = 1;
     blob_box = word->word->bounding_box ();
+    block->re_rotate_box (blob_box);
 
     enhancement = 0;
     if (word->italic > 0)
@@ -83,6 +83,7 @@ char determine_newline_type(                   //test line ends
                            );
 void write_cooked_text(                     //write output
                        WERD *word,          //word to do
+                       BLOCK *block,        //block of word or NULL
                        const STRING &text,  //text to write
                        BOOL8 acceptable,    //good stuff
                        BOOL8 pass2,         //done on pass2
@@ -335,6 +335,7 @@ void make_reject_map(            //make rej map for wd //detailed results
                      WERD_RES *word,
                      BLOB_CHOICE_LIST_CLIST *blob_choices,
                      ROW *row,
+                     BLOCK *block,  //block of word
                      INT16 pass  //1st or 2nd?
                     ) {
   INT16 i;
@@ -410,7 +411,7 @@ void make_reject_map(            //make rej map for wd //detailed results
   }
 
   if (tessedit_image_border > -1)
-    reject_edge_blobs(word);
+    reject_edge_blobs(word, block);
 
   check_debug_pt (word, 10);
   if (tessedit_rejection_debug) {
@@ -425,7 +426,7 @@ void make_reject_map(            //make rej map for wd //detailed results
 
   if (tessedit_use_nn && (pass == 2) &&
     word->reject_map.recoverable_rejects ())
-    nn_recover_rejects(word, row);
+    nn_recover_rejects(word, row, block);
   flip_hyphens(word);
   check_debug_pt (word, 20);
 }
@@ -578,9 +579,10 @@ int sort_floats(                   //qsort function
  *
  * If the word is perilously close to the edge of the image, reject those blobs
  * in the word which are too close to the edge as they could be clipped.
+ * Boxes are mapped back to the page first if the block was turned upright.
  *************************************************************************/
 
-void reject_edge_blobs(WERD_RES *word) {
+void reject_edge_blobs(WERD_RES *word, BLOCK *block) {
   BOX word_box = word->word->bounding_box ();
   BOX blob_box;
   PBLOB_IT blob_it = word->outword->blob_list ();
@@ -588,6 +590,7 @@ void reject_edge_blobs(WERD_RES *word) {
   int blobindex = 0;
   float centre;
 
+  block->re_rotate_box (word_box);
   if ((word_box.left () < tessedit_image_border) ||
     (word_box.bottom () < tessedit_image_border) ||
     (word_box.right () + tessedit_image_border >
@@ -598,13 +601,19 @@ void reject_edge_blobs(WERD_RES *word) {
     !blob_it.cycled_list (); blobindex++, blob_it.forward ()) {
       blob_box = blob_it.data ()->bounding_box ();
       centre = (blob_box.left () + blob_box.right ()) / 2.0;
-      if ((word->denorm.x (blob_box.left ()) < tessedit_image_border) ||
-        (word->denorm.y (blob_box.bottom (), centre) <
-        tessedit_image_border) ||
-        (word->denorm.x (blob_box.right ()) + tessedit_image_border >
+                                 //denormalise
+      blob_box =
+        BOX (ICOORD ((INT16) floor (word->denorm.x (blob_box.left ())),
+        (INT16) floor (word->denorm.y (blob_box.bottom (), centre))),
+        ICOORD ((INT16) ceil (word->denorm.x (blob_box.right ())),
+        (INT16) ceil (word->denorm.y (blob_box.top (), centre))));
+      block->re_rotate_box (blob_box);
+      if ((blob_box.left () < tessedit_image_border) ||
+        (blob_box.bottom () < tessedit_image_border) ||
+        (blob_box.right () + tessedit_image_border >
         page_image.get_xsize () - 1) ||
-        (word->denorm.y (blob_box.top (), centre)
-      + tessedit_image_border > page_image.get_ysize () - 1)) {
+        (blob_box.top () + tessedit_image_border >
+      page_image.get_ysize () - 1)) {
         word->reject_map[blobindex].setrej_edge_char ();
         //close to edge
       }
@@ -947,7 +956,7 @@ void test_ambigs(const char *word) {
  * choice.
  *************************************************************************/
 
-void nn_recover_rejects(WERD_RES *word, ROW *row) {
+void nn_recover_rejects(WERD_RES *word, ROW *row, BLOCK *block) {
                                  //copy for debug
   REJMAP old_map = word->reject_map;
   /*
@@ -958,7 +967,8 @@ void nn_recover_rejects(WERD_RES *word, ROW *row) {
   */
 
   set_global_subsubloc_code(SUBSUBLOC_NN);
-  nn_match_word(word, row);
+  if (block_in_page_frame (block))
+    nn_match_word(word, row);   //clips page_image
 
   if (no_unrej_1Il)
     dont_allow_1Il(word);
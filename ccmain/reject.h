@@ -104,6 +104,7 @@ void make_reject_map(            //make rej map for wd //detailed results
                      WERD_RES *word,
                      BLOB_CHOICE_LIST_CLIST *blob_choices,
                      ROW *row,
+                     BLOCK *block,  //block of word
                      INT16 pass  //1st or 2nd?
                     );
 void reject_blanks(WERD_RES *word); 
@@ -115,7 +116,7 @@ float compute_reject_threshold(  //compute threshold //detailed results
 int sort_floats(                   //qsort function
                 const void *arg1,  //ptrs to floats
                 const void *arg2);
-void reject_edge_blobs(WERD_RES *word); 
+void reject_edge_blobs(WERD_RES *word, BLOCK *block);
 BOOL8 one_ell_conflict(WERD_RES *word_res, BOOL8 update_map); 
 INT16 first_alphanum_pos(const char *word); 
 INT16 alpha_count(const char *word); 
@@ -133,7 +134,7 @@ const char *char_ambiguities(char c);
 void test_ambigs(const char *word);
 #endif
  
-void nn_recover_rejects(WERD_RES *word, ROW *row); 
+void nn_recover_rejects(WERD_RES *word, ROW *row, BLOCK *block);
 void nn_match_word(  //Match a word
                    WERD_RES *word,
                    ROW *row);
@@ -63,6 +63,8 @@
 #define EXTERN
 
 EXTERN BOOL_EVAR (tessedit_write_vars, FALSE, "Write all vars to file");
+EXTERN BOOL_VAR (tessedit_write_snapshot, FALSE,
+"Write vars set by the configs to a binary snapshot file");
 EXTERN BOOL_VAR (tessedit_tweaking_tess_vars, FALSE,
 "Fiddle tess config values");
 
@@ -113,6 +115,13 @@ int init_tesseract(const char *arg0,
       fclose(var_file);
     }
   }
+  if (tessedit_write_snapshot) {
+    var_file = fopen ("edited.vsn", "wb");
+    if (var_file != NULL) {
+      config_snapshot.serialise (var_file);
+      fclose(var_file);
+    }
+  }
   strcpy (c_path, datadir.string ());
   c_path[strlen (c_path) - strlen (m_data_sub_dir.string ())] = '\0';
   demodir = c_path;
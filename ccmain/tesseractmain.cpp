@@ -34,6 +34,7 @@
 #include "globals.h"
 #include "tfacep.h"
 #include "callnet.h"
+#include "permute.h"
 
 #define VARDIR        "configs/" /*variables files */
                                  //config under api
@@ -44,6 +45,8 @@ EXTERN BOOL_VAR (tessedit_read_image, TRUE, "Ensure the image is read");
 EXTERN BOOL_VAR (tessedit_write_images, FALSE,
 "Capture the image from the IPE");
 EXTERN BOOL_VAR (tessedit_debug_to_screen, FALSE, "Dont use debug file");
+EXTERN BOOL_VAR (tessedit_page_manifest, FALSE,
+"Image argument is a file listing imagename [outputbase] per line");
 
 extern INT16 XOFFSET;
 extern INT16 YOFFSET;
@@ -58,36 +61,40 @@ char szAppName[] = "Tessedit";   //app name
  **********************************************************************/
 
 #ifndef GRAPHICS_DISABLED
-int main(int argc, char **argv) {
-  STRING outfile;               //output file
-
-  if (argc < 3) {
-    USAGE.error (argv[0], EXIT,
-      "%s imagename outputbase [configfile [[+|-]varfile]...]\n", argv[0]);
-  }
-
-  if (argc == 3)
-    TessBaseAPI::Init(argv[0], argv[1], NULL, false, 0, argv + 2);
-  else
-    TessBaseAPI::Init(argv[0], argv[1], argv[3], false, argc - 4, argv + 4);
+/**********************************************************************
+ *  recognize_page()
+ *
+ *  Read one image, recognize it with the already initialized engine and
+ *  write outputbase.txt. The image name becomes imagefile and
+ *  imagebasename, as Init makes them for a single page, so box training
+ *  reads imagename.box and the .map, .unlv and .chc files are named
+ *  after each page rather than the manifest.
+ **********************************************************************/
 
-  tprintf ("Tesseract Open Source OCR Engine\n");
+void recognize_page(const char *arg0,        //program name
+                    const char *imagename,   //image to read
+                    const char *outputbase   //name of .txt file
+                   ) {
+  STRING outfile;               //output file
 
+  strncpy(imagefile, imagename, FILENAMESIZE - 1);
+  imagefile[FILENAMESIZE - 1] = '\0';
+  imagebasename = imagename;
   IMAGE image;
 #ifdef _TIFFIO_
-  TIFF* tif = TIFFOpen(argv[1], "r");
+  TIFF* tif = TIFFOpen(imagename, "r");
   if (tif) {
     read_tiff_image(tif, &image);
     TIFFClose(tif);
   } else {
-    READFAILED.error (argv[0], EXIT, argv[1]);
+    READFAILED.error (arg0, EXIT, imagename);
   }
 #else
-  if (image.read_header(argv[1]) < 0)
-    READFAILED.error (argv[0], EXIT, argv[1]);
+  if (image.read_header(imagename) < 0)
+    READFAILED.error (arg0, EXIT, imagename);
   if (image.read(image.get_ysize ()) < 0) {
-    MEMORY_OUT.error(argv[0], EXIT, "Read of image %s",
-      argv[1]);
+    MEMORY_OUT.error(arg0, EXIT, "Read of image %s",
+      imagename);
   }
 #endif
   int bytes_per_line = check_legal_image_size(image.get_xsize(),
@@ -96,14 +103,94 @@ int main(int argc, char **argv) {
   char* text = TessBaseAPI::TesseractRect(image.get_buffer(), image.get_bpp()/8,
                                           bytes_per_line, 0, 0,
                                           image.get_xsize(), image.get_ysize());
-  outfile = argv[2];
+  outfile = outputbase;
   outfile += ".txt";
   FILE* fp = fopen(outfile.string(), "w");
-  if (fp != NULL) {
+  if (fp != NULL && text != NULL) {
     fwrite(text, 1, strlen(text), fp);
-    fclose(fp);
   }
+  if (fp != NULL)
+    fclose(fp);
   delete [] text;
+}
+
+
+/**********************************************************************
+ *  recognize_manifest()
+ *
+ *  Run every page listed in the manifest through one initialized engine.
+ *  The adapted templates and the document dictionary are cleared between
+ *  pages, so a page is not read with what was learned from earlier ones.
+ *  The word result cache, if enabled, is kept across pages on purpose.
+ *  Lines are imagename [outputbase]; blank lines and lines beginning #
+ *  are skipped, and so are lines too long to hold a file name. When
+ *  training from boxes, the samples of all pages go to the one .tr file
+ *  opened for the first page. The outputbase argument of the command
+ *  line is not used in this mode.
+ **********************************************************************/
+
+void recognize_manifest(const char *arg0,      //program name
+                        const char *manifest   //list of pages
+                       ) {
+  FILE *fp;                      //manifest file
+  char line[MAX_PATH];           //input line
+  char imagename[MAX_PATH];      //image to read
+  char outputbase[MAX_PATH];     //output file base
+  int fields;                    //from sscanf
+  int length;                    //of line
+  int c;                         //rest of long line
+  int pages = 0;                 //pages processed
+
+  fp = fopen (manifest, "r");
+  if (fp == NULL)
+    CANTOPENFILE.error (arg0, EXIT, "Manifest %s", manifest);
+  while (fgets (line, MAX_PATH, fp) != NULL) {
+    length = strlen (line);
+    if (length == MAX_PATH - 1 && line[length - 1] != '\n'
+    && (c = fgetc (fp)) != EOF && c != '\n') {
+      tprintf ("Skipping over-long manifest line %.40s...\n", line);
+      while ((c = fgetc (fp)) != EOF && c != '\n');
+      continue;
+    }
+    if (line[0] == '#')
+      continue;
+    fields = sscanf (line, "%s %s", imagename, outputbase);
+    if (fields < 1)
+      continue;
+    if (fields < 2)
+      strcpy(outputbase, imagename);
+    if (pages > 0) {
+      TessBaseAPI::ClearAdaptiveClassifier();
+      clear_document_words();
+    }
+    tprintf ("Page %d: %s\n", pages + 1, imagename);
+    recognize_page(arg0, imagename, outputbase);
+    pages++;
+  }
+  fclose(fp);
+  tprintf ("Processed %d pages from %s\n", pages, manifest);
+}
+
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    USAGE.error (argv[0], EXIT,
+      "%s imagename outputbase [configfile [[+|-]varfile]...]\n"
+      "With tessedit_page_manifest, imagename is a manifest and"
+      " outputbase is ignored\n", argv[0]);
+  }
+
+  if (argc == 3)
+    TessBaseAPI::Init(argv[0], argv[1], NULL, false, 0, argv + 2);
+  else
+    TessBaseAPI::Init(argv[0], argv[1], argv[3], false, argc - 4, argv + 4);
+
+  tprintf ("Tesseract Open Source OCR Engine\n");
+
+  if (tessedit_page_manifest)
+    recognize_manifest(argv[0], argv[1]);
+  else
+    recognize_page(argv[0], argv[1], argv[2]);
   TessBaseAPI::End();
 
   return 0;                      //Normal exit
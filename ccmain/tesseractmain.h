@@ -26,6 +26,15 @@
 #include          "tessembedded.h"
 
 extern BOOL_VAR_H (tessedit_read_image, TRUE, "Ensure the image is read");
+extern BOOL_VAR_H (tessedit_page_manifest, FALSE,
+"Image argument is a file listing imagename [outputbase] per line");
+void recognize_page(const char *arg0,        //program name
+                    const char *imagename,   //image to read
+                    const char *outputbase   //name of .txt file
+                   );
+void recognize_manifest(const char *arg0,      //program name
+                        const char *manifest   //list of pages
+                       );
 INT32 api_main(                   //run from api
                const char *arg0,  //program name
                UINT16 lang        //language
@@ -0,0 +1,396 @@
+/**********************************************************************
+ * File:        wordcache.cpp
+ * Description: Cache of pass 1 results for repeated word images.
+ * Created:     Mon Oct 19 10:12:31 PDT 2026
+ *
+ ** Licensed under the Apache License, Version 2.0 (the "License");
+ ** you may not use this file except in compliance with the License.
+ ** You may obtain a copy of the License at
+ ** http://www.apache.org/licenses/LICENSE-2.0
+ ** Unless required by applicable law or agreed to in writing, software
+ ** distributed under the License is distributed on an "AS IS" BASIS,
+ ** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ ** See the License for the specific language governing permissions and
+ ** limitations under the License.
+ *
+ **********************************************************************/
+
+#include "mfcpch.h"
+#include          <math.h>
+#include          "tprintf.h"
+#include          "wordcache.h"
+#include          "secname.h"
+
+#define EXTERN
+
+#define WORD_CACHE_BUCKETS  1024 //must be a power of 2
+
+EXTERN BOOL_VAR (tessedit_word_cache, FALSE,
+"Reuse pass 1 results for words identical to earlier ones");
+EXTERN INT_VAR (tessedit_word_cache_size, 4000,
+"Most words held in the word result cache");
+EXTERN BOOL_VAR (tessedit_word_cache_stats, FALSE,
+"Print word cache hits and misses");
+
+ELISTIZE (WORD_CACHE_ENTRY)
+                                 //hash buckets
+static WORD_CACHE_ENTRY_LIST cache_buckets[WORD_CACHE_BUCKETS];
+static INT32 cache_entries = 0;  //words held
+static INT32 cache_hits = 0;     //words reused
+static INT32 cache_misses = 0;   //words recognised
+static INT32 cache_collisions = 0;
+                                 //hash equal, shape not
+
+/**********************************************************************
+ * mix_key
+ *
+ * Fold one value into a running outline hash.
+ **********************************************************************/
+
+static inline UINT32 mix_key(              //add to hash
+                             UINT32 key,   //hash so far
+                             INT32 value   //value to add
+                            ) {
+  key ^= (UINT32) value + 0x9e3779b9 + (key << 6) + (key >> 2);
+  return key;
+}
+
+
+/**********************************************************************
+ * outline_key
+ *
+ * Hash a list of outlines and their children. Start positions are
+ * taken relative to origin so the hash does not depend on where the
+ * word is on the page.
+ **********************************************************************/
+
+static UINT32 outline_key(                          //hash outlines
+                          C_OUTLINE_LIST *outlines, //outlines to hash
+                          ICOORD origin,            //word bottom left
+                          UINT32 key                //hash so far
+                         ) {
+  C_OUTLINE_IT it = outlines;    //outline iterator
+  C_OUTLINE *outline;            //current outline
+  INT16 stepindex;               //index of step
+
+  for (it.mark_cycle_pt (); !it.cycled_list (); it.forward ()) {
+    outline = it.data ();
+    key = mix_key (key, outline->start_pos ().x () - origin.x ());
+    key = mix_key (key, outline->start_pos ().y () - origin.y ());
+    key = mix_key (key, outline->pathlength ());
+    for (stepindex = 0; stepindex < outline->pathlength (); stepindex++)
+      key = mix_key (key, outline->step_dir (stepindex).get_dir ());
+    key = outline_key (outline->child (), origin, key);
+  }
+  return key;
+}
+
+
+/**********************************************************************
+ * outlines_equal
+ *
+ * Compare two lists of outlines step by step, with each list's start
+ * positions taken relative to its own origin.
+ **********************************************************************/
+
+static BOOL8 outlines_equal(                          //same shape?
+                            C_OUTLINE_LIST *outlines1,
+                            ICOORD origin1,           //bottom left of 1
+                            C_OUTLINE_LIST *outlines2,
+                            ICOORD origin2            //bottom left of 2
+                           ) {
+  C_OUTLINE_IT it1 = outlines1;  //outline iterators
+  C_OUTLINE_IT it2 = outlines2;
+  C_OUTLINE *outline1;           //current outlines
+  C_OUTLINE *outline2;
+  INT16 stepindex;               //index of step
+
+  if (outlines1->length () != outlines2->length ())
+    return FALSE;
+  for (it1.mark_cycle_pt (); !it1.cycled_list ();
+  it1.forward (), it2.forward ()) {
+    outline1 = it1.data ();
+    outline2 = it2.data ();
+    if (outline1->pathlength () != outline2->pathlength ()
+      || outline1->start_pos () - origin1 != outline2->start_pos () - origin2)
+      return FALSE;
+    for (stepindex = 0; stepindex < outline1->pathlength (); stepindex++) {
+      if (outline1->step_dir (stepindex).get_dir ()
+        != outline2->step_dir (stepindex).get_dir ())
+        return FALSE;
+    }
+    if (!outlines_equal (outline1->child (), origin1,
+      outline2->child (), origin2))
+      return FALSE;
+  }
+  return TRUE;
+}
+
+
+/**********************************************************************
+ * words_equal
+ *
+ * Test whether two compact blob words have identical outlines.
+ **********************************************************************/
+
+static BOOL8 words_equal(         //same shape?
+                         WERD *word1,
+                         WERD *word2
+                        ) {
+  C_BLOB_IT it1 = word1->cblob_list ();
+  C_BLOB_IT it2 = word2->cblob_list ();
+  ICOORD origin1 = word1->bounding_box ().botleft ();
+  ICOORD origin2 = word2->bounding_box ().botleft ();
+
+  if (word1->bounding_box ().width () != word2->bounding_box ().width ()
+    || word1->bounding_box ().height () != word2->bounding_box ().height ()
+    || word1->cblob_list ()->length () != word2->cblob_list ()->length ())
+    return FALSE;
+  for (it1.mark_cycle_pt (); !it1.cycled_list ();
+  it1.forward (), it2.forward ()) {
+    if (!outlines_equal (it1.data ()->out_list (), origin1,
+      it2.data ()->out_list (), origin2))
+      return FALSE;
+  }
+  return TRUE;
+}
+
+
+/**********************************************************************
+ * word_key
+ *
+ * Make the cache key for a word from its outlines, its baseline
+ * position and rise and the x-height of its row.
+ **********************************************************************/
+
+static UINT32 word_key(                //hash word
+                       WERD *word,     //word to hash
+                       INT32 baseline, //baseline above bottom
+                       INT32 rise,     //baseline rise over word
+                       float x_height  //row x-height
+                      ) {
+  C_BLOB_IT blob_it = word->cblob_list ();
+  ICOORD origin = word->bounding_box ().botleft ();
+  UINT32 key;                    //result
+
+  key = mix_key (0, baseline);
+  key = mix_key (key, rise);
+  key = mix_key (key, (INT32) floor (x_height + 0.5));
+  for (blob_it.mark_cycle_pt (); !blob_it.cycled_list (); blob_it.forward ())
+    key = outline_key (blob_it.data ()->out_list (), origin, key);
+  return key;
+}
+
+
+/**********************************************************************
+ * word_baseline
+ *
+ * Height of the row baseline above the bottom of the word, rounded.
+ **********************************************************************/
+
+static INT32 word_baseline(            //baseline offset
+                           WERD *word,
+                           ROW *row
+                          ) {
+  BOX box = word->bounding_box ();
+
+  return (INT32) floor (row->base_line (box.left ()) - box.bottom () + 0.5);
+}
+
+
+/**********************************************************************
+ * word_baseline_rise
+ *
+ * Rise of the row baseline from the left to the right of the word,
+ * rounded. Words on rows of different slope normalise differently.
+ **********************************************************************/
+
+static INT32 word_baseline_rise(            //baseline slope
+                                WERD *word,
+                                ROW *row
+                               ) {
+  BOX box = word->bounding_box ();
+
+  return (INT32) floor (row->base_line (box.right ())
+    - row->base_line (box.left ()) + 0.5);
+}
+
+
+/**********************************************************************
+ * WORD_CACHE_ENTRY::WORD_CACHE_ENTRY
+ *
+ * Copy the outlines and pass 1 result of a word.
+ **********************************************************************/
+
+WORD_CACHE_ENTRY::WORD_CACHE_ENTRY(                      //constructor
+                                   UINT32 hash_key,      //outline hash
+                                   WERD_RES *word,       //word and result
+                                   INT32 baseline,       //baseline above bottom
+                                   INT32 rise,           //baseline rise
+                                   float row_x_height    //row x-height
+                                  ) {
+  key = hash_key;
+  baseline_offset = baseline;
+  baseline_rise = rise;
+  x_height = row_x_height;
+  shape = new WERD;
+  *shape = *(word->word);        //deep copy
+  result = new WERD_RES;
+  *result = *word;               //deep copy of results
+  result->word = shape;
+}
+
+
+/**********************************************************************
+ * WORD_CACHE_ENTRY::~WORD_CACHE_ENTRY
+ **********************************************************************/
+
+WORD_CACHE_ENTRY::~WORD_CACHE_ENTRY () {
+  if (result != NULL) {
+    result->word = NULL;         //owned by shape
+    delete result;
+  }
+  if (shape != NULL)
+    delete shape;
+}
+
+
+/**********************************************************************
+ * word_cacheable
+ *
+ * Only plain compact blob words are cached. Fuzzy space combinations and
+ * repeated character words are left to the normal path.
+ **********************************************************************/
+
+BOOL8 word_cacheable(                 //can be cached?
+                     WERD_RES *word   //word to check
+                    ) {
+  return !word->combination && !word->part_of_combo
+    && !word->word->flag (W_POLYGON) && !word->word->flag (W_LINEARC)
+    && !word->word->flag (W_REP_CHAR)
+    && !word->word->cblob_list ()->empty ();
+}
+
+
+/**********************************************************************
+ * word_cache_lookup
+ *
+ * Look for an earlier word with exactly the same outlines, baseline
+ * position and rise and row x-height. If found, copy its pass 1 result into word and return
+ * TRUE. The caller must already have set up word->denorm.
+ **********************************************************************/
+
+BOOL8 word_cache_lookup(                 //find earlier result
+                        WERD_RES *word,  //word to fill
+                        ROW *row
+                       ) {
+  WORD_CACHE_ENTRY_IT it;        //bucket iterator
+  WORD_CACHE_ENTRY *entry;       //candidate
+  WERD_RES *source;              //cached result
+  INT32 baseline;                //baseline offset
+  INT32 rise;                    //baseline rise
+  UINT32 key;                    //outline hash
+
+  if (!word_cacheable (word))
+    return FALSE;
+  baseline = word_baseline (word->word, row);
+  rise = word_baseline_rise (word->word, row);
+  key = word_key (word->word, baseline, rise, row->x_height ());
+  it.set_to_list (&cache_buckets[key & (WORD_CACHE_BUCKETS - 1)]);
+  for (it.mark_cycle_pt (); !it.cycled_list (); it.forward ()) {
+    entry = it.data ();
+    if (entry->key != key)
+      continue;
+    if (entry->baseline_offset != baseline || entry->baseline_rise != rise
+      || fabs (entry->x_height - row->x_height ()) > 0.5
+    || !words_equal (entry->shape, word->word)) {
+      cache_collisions++;
+      continue;
+    }
+    source = entry->result;
+    word->outword = new WERD;
+    *(word->outword) = *(source->outword);
+    word->best_choice = new WERD_CHOICE;
+    *(word->best_choice) = *(source->best_choice);
+    word->raw_choice = new WERD_CHOICE;
+    *(word->raw_choice) = *(source->raw_choice);
+    word->reject_map = source->reject_map;
+    word->tess_failed = source->tess_failed;
+    word->tess_accepted = source->tess_accepted;
+    word->tess_would_adapt = source->tess_would_adapt;
+    word->done = source->done;
+    word->italic = source->italic;
+    word->bold = source->bold;
+    word->font1 = source->font1;
+    word->font1_count = source->font1_count;
+    word->font2 = source->font2;
+    word->font2_count = source->font2_count;
+    cache_hits++;
+    return TRUE;
+  }
+  cache_misses++;
+  return FALSE;
+}
+
+
+/**********************************************************************
+ * word_cache_store
+ *
+ * Remember the pass 1 result of a word, unless the cache is full.
+ **********************************************************************/
+
+void word_cache_store(                 //remember result
+                      WERD_RES *word,  //recognized word
+                      ROW *row
+                     ) {
+  WORD_CACHE_ENTRY_IT it;        //bucket iterator
+  INT32 baseline;                //baseline offset
+  INT32 rise;                    //baseline rise
+  UINT32 key;                    //outline hash
+
+  if (cache_entries >= tessedit_word_cache_size || !word_cacheable (word)
+    || word->tess_failed || word->outword == NULL
+    || word->best_choice == NULL)
+    return;
+  baseline = word_baseline (word->word, row);
+  rise = word_baseline_rise (word->word, row);
+  key = word_key (word->word, baseline, rise, row->x_height ());
+  it.set_to_list (&cache_buckets[key & (WORD_CACHE_BUCKETS - 1)]);
+  it.add_to_end (new WORD_CACHE_ENTRY (key, word, baseline, rise,
+    row->x_height ()));
+  cache_entries++;
+}
+
+
+/**********************************************************************
+ * clear_word_cache
+ *
+ * Throw away all cached words. Called when the engine is shut down. The
+ * cache lives across pages on purpose, so a repeated word reuses the
+ * result of the page it was first seen on, whatever the adaptive
+ * classifier has learned or forgotten since.
+ **********************************************************************/
+
+void clear_word_cache() {
+  INT32 bucket;                  //bucket index
+
+  for (bucket = 0; bucket < WORD_CACHE_BUCKETS; bucket++)
+    cache_buckets[bucket].clear ();
+  cache_entries = 0;
+}
+
+
+/**********************************************************************
+ * print_word_cache_stats
+ *
+ * Report the use of the cache since the last call.
+ **********************************************************************/
+
+void print_word_cache_stats() {
+  tprintf ("Word cache: " INT32FORMAT " hits, " INT32FORMAT " misses, "
+    INT32FORMAT " collisions, " INT32FORMAT " words held\n",
+    cache_hits, cache_misses, cache_collisions, cache_entries);
+  cache_hits = 0;
+  cache_misses = 0;
+  cache_collisions = 0;
+}
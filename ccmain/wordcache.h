@@ -0,0 +1,78 @@
+/**********************************************************************
+ * File:        wordcache.h
+ * Description: Cache of pass 1 results for repeated word images.
+ * Created:     Mon Oct 19 10:12:31 PDT 2026
+ *
+ ** Licensed under the Apache License, Version 2.0 (the "License");
+ ** you may not use this file except in compliance with the License.
+ ** You may obtain a copy of the License at
+ ** http://www.apache.org/licenses/LICENSE-2.0
+ ** Unless required by applicable law or agreed to in writing, software
+ ** distributed under the License is distributed on an "AS IS" BASIS,
+ ** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ ** See the License for the specific language governing permissions and
+ ** limitations under the License.
+ *
+ **********************************************************************/
+
+#ifndef           WORDCACHE_H
+#define           WORDCACHE_H
+
+#include          "varable.h"
+#include          "elst.h"
+#include          "pageres.h"
+#include          "memry.h"
+#include          "notdll.h"
+
+extern BOOL_VAR_H (tessedit_word_cache, FALSE,
+"Reuse pass 1 results for words identical to earlier ones");
+extern INT_VAR_H (tessedit_word_cache_size, 4000,
+"Most words held in the word result cache");
+extern BOOL_VAR_H (tessedit_word_cache_stats, FALSE,
+"Print word cache hits and misses");
+
+/**********************************************************************
+ * WORD_CACHE_ENTRY
+ *
+ * One cached word: a copy of its compact outlines for verification and
+ * a copy of its pass 1 result. Outline starts are held relative to the
+ * bottom left of the word so that the same word matches anywhere on
+ * any page.
+ **********************************************************************/
+
+class WORD_CACHE_ENTRY:public ELIST_LINK
+{
+  public:
+    WORD_CACHE_ENTRY() {  //for elist only
+      shape = NULL;
+      result = NULL;
+    }
+    WORD_CACHE_ENTRY(                      //constructor
+                     UINT32 hash_key,      //outline hash
+                     WERD_RES *word,       //word and result
+                     INT32 baseline,       //baseline above bottom
+                     INT32 rise,           //baseline rise
+                     float row_x_height);  //row x-height
+    ~WORD_CACHE_ENTRY ();
+
+    UINT32 key;                  //outline hash
+    INT32 baseline_offset;       //baseline above bottom
+    INT32 baseline_rise;         //baseline rise over word
+    float x_height;              //row x-height
+    WERD *shape;                 //compact outlines
+    WERD_RES *result;            //pass 1 result
+
+    NEWDELETE2 (WORD_CACHE_ENTRY)
+};
+
+ELISTIZEH (WORD_CACHE_ENTRY)
+BOOL8 word_cacheable(WERD_RES *word);
+BOOL8 word_cache_lookup(                 //find earlier result
+                        WERD_RES *word,  //word to fill
+                        ROW *row);
+void word_cache_store(                 //remember result
+                      WERD_RES *word,  //recognized word
+                      ROW *row);
+void clear_word_cache();
+void print_word_cache_stats();
+#endif
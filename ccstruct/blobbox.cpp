@@ -67,10 +67,16 @@ void BLOBNBOX::chop(                        //chop blobs
   float test_ymin, test_ymax;    //limits of part blob
   ICOORD bl, tr;                 //corners of box
   BLOBNBOX_IT blob_it;           //blob iterator
+  C_BLOB_LIMITS *limits;         //tabulated single cblob
 
                                  //get no of chops
   blobcount = (INT16) floor (box.width () / xheight);
   if (blobcount > 1 && (blob_ptr != NULL || cblob_ptr != NULL)) {
+    blob = start_it->data ();
+    limits = NULL;
+    if (blob == end_it->data () && blob->blob_ptr == NULL
+      && blob->cblob_ptr != NULL)
+      limits = new C_BLOB_LIMITS (blob->cblob_ptr);
                                  //width of each
     blobwidth = (float) (box.width () + 1) / blobcount;
     for (blobindex = blobcount - 1, rightx = box.right ();
@@ -83,6 +89,9 @@ void BLOBNBOX::chop(                        //chop blobs
         if (blob->blob_ptr != NULL)
           find_blob_limits (blob->blob_ptr, rightx - blobwidth, rightx,
             rotation, test_ymin, test_ymax);
+        else if (limits != NULL)
+          limits->find_vlimits (rightx - blobwidth, rightx,
+            test_ymin, test_ymax);
         else
           find_cblob_vlimits (blob->cblob_ptr, rightx - blobwidth,
             rightx,
@@ -111,6 +120,8 @@ void BLOBNBOX::chop(                        //chop blobs
         }
       }
     }
+    if (limits != NULL)
+      delete limits;
   }
 }
 
@@ -301,6 +312,136 @@ void find_cblob_hlimits(                //get x limits
 }
 
 
+/**********************************************************************
+ * C_BLOB_LIMITS::C_BLOB_LIMITS
+ *
+ * Walk the outlines of the cblob once, recording the min and max x of
+ * the points on each scan line and the min and max y on each column.
+ **********************************************************************/
+
+C_BLOB_LIMITS::C_BLOB_LIMITS(               //constructor
+                             C_BLOB *blob   //blob to tabulate
+                            ) {
+  INT16 stepindex;               //current point
+  INT32 index;                   //table index
+  INT32 rows;                    //table sizes
+  INT32 cols;
+  ICOORD pos;                    //current coords
+  C_OUTLINE *outline;            //current outline
+                                 //outlines
+  C_OUTLINE_IT out_it = blob->out_list ();
+
+  box = blob->bounding_box ();
+  rows = box.height () + 1;
+  cols = box.width () + 1;
+  row_xmin = (INT16 *) alloc_mem (rows * sizeof (INT16));
+  row_xmax = (INT16 *) alloc_mem (rows * sizeof (INT16));
+  col_ymin = (INT16 *) alloc_mem (cols * sizeof (INT16));
+  col_ymax = (INT16 *) alloc_mem (cols * sizeof (INT16));
+  for (index = 0; index < rows; index++) {
+    row_xmin[index] = MAX_INT16;
+    row_xmax[index] = -MAX_INT16;
+  }
+  for (index = 0; index < cols; index++) {
+    col_ymin[index] = MAX_INT16;
+    col_ymax[index] = -MAX_INT16;
+  }
+  for (out_it.mark_cycle_pt (); !out_it.cycled_list (); out_it.forward ()) {
+    outline = out_it.data ();
+    pos = outline->start_pos (); //get coords
+    for (stepindex = 0; stepindex < outline->pathlength (); stepindex++) {
+      index = pos.y () - box.bottom ();
+      if (pos.x () < row_xmin[index])
+        row_xmin[index] = pos.x ();
+      if (pos.x () > row_xmax[index])
+        row_xmax[index] = pos.x ();
+      index = pos.x () - box.left ();
+      if (pos.y () < col_ymin[index])
+        col_ymin[index] = pos.y ();
+      if (pos.y () > col_ymax[index])
+        col_ymax[index] = pos.y ();
+      pos += outline->step (stepindex);
+    }
+  }
+}
+
+
+/**********************************************************************
+ * C_BLOB_LIMITS::~C_BLOB_LIMITS
+ **********************************************************************/
+
+C_BLOB_LIMITS::~C_BLOB_LIMITS () {
+  free_mem(row_xmin);
+  free_mem(row_xmax);
+  free_mem(col_ymin);
+  free_mem(col_ymax);
+}
+
+
+/**********************************************************************
+ * C_BLOB_LIMITS::find_vlimits
+ *
+ * As find_cblob_vlimits, but from the column table.
+ **********************************************************************/
+
+void C_BLOB_LIMITS::find_vlimits(              //get y limits
+                                 float leftx,  //x limits
+                                 float rightx,
+                                 float &ymin,  //output y limits
+                                 float &ymax
+                                ) const {
+  INT32 x;                       //column
+  INT32 maxx;                    //last column
+  INT32 index;                   //table index
+
+  ymin = (float) MAX_INT32;
+  ymax = (float) -MAX_INT32;
+  x = leftx > box.left () ? (INT32) ceil (leftx) : box.left ();
+  maxx = rightx < box.right () ? (INT32) floor (rightx) : box.right ();
+  for (; x <= maxx; x++) {
+    index = x - box.left ();
+    if (col_ymin[index] > col_ymax[index])
+      continue;                  //no points in column
+    if (col_ymin[index] < ymin)
+      ymin = col_ymin[index];
+    if (col_ymax[index] > ymax)
+      ymax = col_ymax[index];
+  }
+}
+
+
+/**********************************************************************
+ * C_BLOB_LIMITS::find_hlimits
+ *
+ * As find_cblob_hlimits, but from the scan line table.
+ **********************************************************************/
+
+void C_BLOB_LIMITS::find_hlimits(               //get x limits
+                                 float bottomy, //y limits
+                                 float topy,
+                                 float &xmin,   //output x limits
+                                 float &xmax
+                                ) const {
+  INT32 y;                       //scan line
+  INT32 maxy;                    //last line
+  INT32 index;                   //table index
+
+  xmin = (float) MAX_INT32;
+  xmax = (float) -MAX_INT32;
+  y = bottomy > box.bottom () ? (INT32) ceil (bottomy) : box.bottom ();
+  maxy = topy < box.top () ? (INT32) floor (topy) : box.top ();
+  for (; y <= maxy; y++) {
+    index = y - box.bottom ();
+    if (row_xmin[index] > row_xmax[index])
+      continue;                  //no points on line
+    if (row_xmin[index] < xmin)
+      xmin = row_xmin[index];
+    if (row_xmax[index] > xmax)
+      xmax = row_xmax[index];
+  }
+}
+
+
 /**********************************************************************
  * rotate_blob
  *
@@ -369,26 +510,52 @@ PBLOB *rotate_cblob(                 //rotate it
 }
 
 
+/**********************************************************************
+ * crotate_outline_list
+ *
+ * Rotate each outline of the list into the destination list, keeping
+ * the child outlines and inverse flags so that holes survive.
+ **********************************************************************/
+
+static void crotate_outline_list(                          //rotate outlines
+                                 C_OUTLINE_LIST *src_list,  //outlines to copy
+                                 C_OUTLINE_LIST *dest_list, //rotated copies
+                                 FCOORD rotation            //for landscape
+                                ) {
+  C_OUTLINE_IT src_it = src_list;
+  C_OUTLINE_IT dest_it = dest_list;
+  C_OUTLINE *src_outline;        //outline to copy
+  C_OUTLINE *dest_outline;       //rotated copy
+
+  for (src_it.mark_cycle_pt (); !src_it.cycled_list (); src_it.forward ()) {
+    src_outline = src_it.data ();
+    dest_outline = new C_OUTLINE (src_outline, rotation);
+    dest_outline->set_flag (COUT_INVERSE,
+      src_outline->flag (COUT_INVERSE));
+    crotate_outline_list (src_outline->child (), dest_outline->child (),
+      rotation);
+    dest_it.add_after_then_move (dest_outline);
+  }
+}
+
+
 /**********************************************************************
  * crotate_cblob
  *
  * Rotate the copy by the given vector and return a C_BLOB.
+ * The outline tree is copied as it stands, holes included.
  **********************************************************************/
 
 C_BLOB *crotate_cblob(                 //rotate it
                       C_BLOB *blob,    //blob to search
                       FCOORD rotation  //for landscape
                      ) {
-  C_OUTLINE_LIST out_list;       //output outlines
-                                 //input outlines
-  C_OUTLINE_IT in_it = blob->out_list ();
-                                 //output outlines
-  C_OUTLINE_IT out_it = &out_list;
-
-  for (in_it.mark_cycle_pt (); !in_it.cycled_list (); in_it.forward ()) {
-    out_it.add_after_then_move (new C_OUTLINE (in_it.data (), rotation));
-  }
-  return new C_BLOB (&out_list);
+  C_OUTLINE_LIST out_list;       //no outlines yet
+  C_BLOB *copy;                  //rotated copy
+
+  copy = new C_BLOB (&out_list);
+  crotate_outline_list (blob->out_list (), copy->out_list (), rotation);
+  return copy;
 }
 
 
@@ -315,6 +315,40 @@ class TO_BLOCK:public ELIST_LINK
 };
 
 ELISTIZEH (TO_BLOCK)
+/**********************************************************************
+ * C_BLOB_LIMITS
+ *
+ * The x extent of each scan line and the y extent of each column of a
+ * cblob, found in one walk of its outlines. Repeated limit queries on
+ * the same blob then need no further walks.
+ **********************************************************************/
+
+class C_BLOB_LIMITS
+{
+  public:
+    C_BLOB_LIMITS(               //constructor
+                  C_BLOB *blob); //blob to tabulate
+    ~C_BLOB_LIMITS ();
+
+    void find_vlimits(              //get y limits
+                      float leftx,  //x limits
+                      float rightx,
+                      float &ymin,  //output y limits
+                      float &ymax) const;
+    void find_hlimits(               //get x limits
+                      float bottomy, //y limits
+                      float topy,
+                      float &xmin,   //output x limits
+                      float &xmax) const;
+
+    NEWDELETE2 (C_BLOB_LIMITS) private:
+    BOX box;                     //blob box
+    INT16 *row_xmin;             //x extent of each y
+    INT16 *row_xmax;
+    INT16 *col_ymin;             //y extent of each x
+    INT16 *col_ymax;
+};
+
 extern double_VAR_H (textord_error_weight, 3,
 "Weighting for error in believability");
 void find_blob_limits(                  //get y limits
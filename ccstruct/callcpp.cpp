@@ -97,13 +97,10 @@ cprintf (                        //Trace printf
 const char *format, ...          //special message
 ) {
   va_list args;                  //variable args
-  char msg[1000];
 
   va_start(args, format);  //variable list
-  vsprintf(msg, format, args);  //Format into msg
+  vtprintf(format, args);
   va_end(args); 
-
-  tprintf ("%s", msg);
 }
 
 
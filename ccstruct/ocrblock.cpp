@@ -51,6 +51,7 @@ filename(name) {  //box(ICOORD(xmin,ymin),ICOORD(xmax,ymax))
   font_class = -1;               //not assigned
   hand_block = NULL;
   hand_poly = NULL;
+  text_rotation = FCOORD (1.0f, 0.0f);
   left_it.set_to_list (&leftside);
   right_it.set_to_list (&rightside);
                                  //make default box
@@ -147,6 +148,21 @@ int decreasing_top_order(  //
 }
 
 
+/**********************************************************************
+ * BLOCK::re_rotate_box
+ *
+ * Map a box from the upright frame the block was recognised in back to
+ * the page.
+ **********************************************************************/
+
+void BLOCK::re_rotate_box(                  //back to page frame
+                          BOX &box          //box to map
+                         ) const {
+  box.move (-text_shift);
+  box.rotate (FCOORD (text_rotation.x (), -text_rotation.y ()));
+}
+
+
 /**********************************************************************
  * BLOCK::sort_rows
  *
@@ -355,6 +371,8 @@ const BLOCK & source             //from this
   kerning = source.kerning;
   spacing = source.spacing;
   filename = source.filename;    //STRINGs assign ok
+  text_rotation = source.text_rotation;
+  text_shift = source.text_shift;
   if (!rows.empty ())
     rows.clear ();
   //   if ( !leftside.empty() )
@@ -53,6 +53,7 @@ class BLOCK:public ELIST_LINK, public PDBLK
     BLOCK() {  //empty constructor
       hand_block = NULL;
       hand_poly = NULL;
+      text_rotation = FCOORD (1.0f, 0.0f);
     }
     BLOCK(                   //simple constructor
           const char *name,  //filename
@@ -127,6 +128,17 @@ class BLOCK:public ELIST_LINK, public PDBLK
     C_BLOB_LIST *reject_blobs() { 
       return &rej_blobs;
     }
+    FCOORD rotation() const {  //to upright frame
+      return text_rotation;
+    }
+    void set_rotation(                   //set upright frame
+                      FCOORD rotation,   //rotation applied
+                      ICOORD shift) {    //then move applied
+      text_rotation = rotation;
+      text_shift = shift;
+    }
+    void re_rotate_box(               //back to page frame
+                       BOX &box) const;  //box to map
     //      void                                                    bounding_box(                                           //get box
     //              ICOORD&                                 bottom_left,                                            //bottom left
     //              ICOORD&                                 top_right) const                                        //topright
@@ -217,6 +229,8 @@ class BLOCK:public ELIST_LINK, public PDBLK
     ROW_LIST rows;               //rows in block
     C_BLOB_LIST c_blobs;         //before textord
     C_BLOB_LIST rej_blobs;       //duff stuff
+    FCOORD text_rotation;        //to upright frame
+    ICOORD text_shift;           //after rotation
     //      ICOORDELT_LIST                          leftside;                                                       //left side vertices
     //      ICOORDELT_LIST                          rightside;                                                      //right side vertices
     //      BOX                                                     box;                                                                    //bounding box
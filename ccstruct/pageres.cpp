@@ -24,6 +24,8 @@
 #include          "pageres.h"
 #include          "notdll.h"
 
+const ERRCODE CANT_COPY_ROW_RES = "Can't copy a ROW_RES";
+
 ELISTIZE (BLOCK_RES)
 CLISTIZE (BLOCK_RES) ELISTIZE (ROW_RES) ELISTIZE (WERD_RES)
 /*************************************************************************
@@ -99,6 +101,8 @@ ROW_RES::ROW_RES(              //recursive construct
   font_class_score = -1.0;
   bold = FALSE;
   italic = FALSE;
+  word_count = 0;
+  word_table = NULL;
 
   row = the_row;
 
@@ -125,6 +129,47 @@ ROW_RES::ROW_RES(              //recursive construct
       combo = NULL;
     word_res_it.add_to_end (word_res);
   }
+  index_words();
+}
+
+
+/*************************************************************************
+ * ROW_RES::index_words
+ *
+ * Rebuild the table of word results in list order, for random access to
+ * the words of the row. Must be called again whenever words are added to
+ * or removed from word_res_list.
+ *************************************************************************/
+
+void ROW_RES::index_words() {
+  WERD_RES_IT word_res_it(&word_res_list);
+
+  if (word_table != NULL)
+    free_mem(word_table);
+  word_table = NULL;
+  word_count = word_res_list.length ();
+  if (word_count == 0)
+    return;
+  word_table = (WERD_RES **) alloc_mem (word_count * sizeof (WERD_RES *));
+  word_count = 0;
+  for (word_res_it.mark_cycle_pt ();
+  !word_res_it.cycled_list (); word_res_it.forward ())
+    word_table[word_count++] = word_res_it.data ();
+}
+
+
+/*************************************************************************
+ * ROW_RES::operator=
+ *
+ * Only the list deep copier can reach this. A copy would share, and
+ * later free again, the word_table of the source, so it is refused.
+ *************************************************************************/
+
+ROW_RES & ROW_RES::operator= (   //assign row_res
+const ROW_RES &                  //from this
+) {
+  CANT_COPY_ROW_RES.error ("ROW_RES::operator=", ABORT, NULL);
+  return *this;
 }
 
 
@@ -25,6 +25,7 @@
 #include          "werd.h"
 #include          "ratngs.h"
 #include          "rejctmap.h"
+#include          "memry.h"
 #include          "notdll.h"
 #include          "notdll.h"
 
@@ -90,6 +91,8 @@ class BLOCK_RES:public ELIST_LINK
 
     ~BLOCK_RES () {              //destructor
     }
+
+    NEWDELETE2 (BLOCK_RES)
 };
 
 /*************************************************************************
@@ -112,15 +115,41 @@ class ROW_RES:public ELIST_LINK  //row result
     INT8 font1_count;            //no of voters
     INT8 font2;                  //secondary font
     INT8 font2_count;            //no of voters
+    INT32 word_count;            //entries in word_table
+    WERD_RES **word_table;       //words in list order
 
-    ROW_RES() { 
-    }                            //empty constructor
+    ROW_RES() {                  //empty constructor
+      word_count = 0;
+      word_table = NULL;
+    }
 
     ROW_RES(                //simple constructor
             ROW *the_row);  //real row
 
     ~ROW_RES () {                //destructor
+      if (word_table != NULL)
+        free_mem(word_table);
+    }
+
+    void index_words();  //rebuild word_table
+
+    WERD_RES *word(                  //get word by index
+                   INT32 index) {    //position in list
+      #ifdef _DEBUG
+                                 //index_words not called
+      ASSERT_HOST (word_count == word_res_list.length ());
+      #endif
+      return word_table[index];
     }
+
+    NEWDELETE2 (ROW_RES)
+
+  private:
+                                 //would share word_table
+    ROW_RES(const ROW_RES &);
+    ROW_RES & operator= (const ROW_RES &);
+                                 //made by ELISTIZE
+    friend ELIST_LINK *ROW_RES_copier(ELIST_LINK *);
 };
 
 /*************************************************************************
@@ -231,6 +260,8 @@ class WERD_RES:public ELIST_LINK //word result
       word->set_flag (W_EOL, word_res->word->flag (W_EOL));
       word->copy_on (word_res->word);
     }
+
+    NEWDELETE2 (WERD_RES)
 };
 
 /*************************************************************************
@@ -123,6 +123,30 @@ void PDBLK::move(                  // reposition block
 }
 
 
+/**********************************************************************
+ * PDBLK::rotate
+ *
+ * Rotate the block by a multiple of 90 degrees. The vertex lists are
+ * replaced by the rotated bounding box.
+ **********************************************************************/
+
+void PDBLK::rotate(                  // rotate block
+                   const FCOORD vec  // by (cos,sin) vector
+                  ) {
+  ICOORDELT_IT left_it = &leftside;
+  ICOORDELT_IT right_it = &rightside;
+
+  box.rotate (vec);
+  leftside.clear ();
+  rightside.clear ();
+                                 //make default box
+  left_it.add_to_end (new ICOORDELT (box.left (), box.bottom ()));
+  left_it.add_to_end (new ICOORDELT (box.left (), box.top ()));
+  right_it.add_to_end (new ICOORDELT (box.right (), box.bottom ()));
+  right_it.add_to_end (new ICOORDELT (box.right (), box.top ()));
+}
+
+
 /**********************************************************************
  * PDBLK::plot
  *
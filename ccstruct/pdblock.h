@@ -94,6 +94,9 @@ class DLLSYM PDBLK               //page block
     void move(                    // reposition block
               const ICOORD vec);  // by vector
 
+    void rotate(                  // rotate block
+                const FCOORD vec);  // by (cos,sin) vector
+
     void plot(                 //draw histogram
               WINDOW window,   //window to draw in
               INT32 serial,    //serial number
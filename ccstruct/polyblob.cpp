@@ -251,9 +251,10 @@ PBLOB *PBLOB::baseline_normalise(                //normalize blob
   *denorm = DENORM (x_centre, bln_x_height / row->x_height (), row);
   bn_blob = new PBLOB;           //get one
   *bn_blob = *this;              //deep copy
-  bn_blob->move (FCOORD (-denorm->origin (), -row->base_line (x_centre)));
-  bn_blob->scale (denorm->scale ());
-  bn_blob->move (FCOORD (0.0, bln_baseline_offset));
+  bn_blob->move_scale_move (FCOORD (-denorm->origin (),
+    -row->base_line (x_centre)),
+    FCOORD (denorm->scale (), denorm->scale ()),
+    FCOORD (0.0, bln_baseline_offset));
   return bn_blob;
 }
 
@@ -268,14 +269,15 @@ void PBLOB::baseline_denormalise(                      // Tess style BL Norm
                                  const DENORM *denorm  //antidote
                                 ) {
   float blob_x_left;           // Left edge of blob.
+  float factor;                  //inverse scale
   BOX blob_box;                  //blob bounding box
 
-  move(FCOORD (0.0f, 0.0f - bln_baseline_offset));
-  blob_box = bounding_box ();
+  blob_box = bounding_box ();    //left unchanged by y move
   blob_x_left = blob_box.left ();
-  scale (1.0 / denorm->scale_at_x (blob_x_left));
-  move (FCOORD (denorm->origin (),
-    denorm->yshift_at_x (blob_x_left)));
+  factor = 1.0 / denorm->scale_at_x (blob_x_left);
+  move_scale_move (FCOORD (0.0f, 0.0f - bln_baseline_offset),
+    FCOORD (factor, factor),
+    FCOORD (denorm->origin (), denorm->yshift_at_x (blob_x_left)));
 }
 
 
@@ -327,6 +329,24 @@ void PBLOB::scale(                  // scale blob
 }
 
 
+/**********************************************************************
+ * PBLOB::move_scale_move
+ *
+ * Move, scale and move again in a single pass over each outline.
+ **********************************************************************/
+
+void PBLOB::move_scale_move(                        //transform blob
+                            const FCOORD pre_vec,   //first move
+                            const FCOORD factor,    //then scale
+                            const FCOORD post_vec   //then move
+                           ) {
+  OUTLINE_IT it(&outlines);  // iterator
+
+  for (it.mark_cycle_pt (); !it.cycled_list (); it.forward ())
+    it.data ()->move_scale_move (pre_vec, factor, post_vec);
+}
+
+
 /**********************************************************************
  * PBLOB::plot
  *
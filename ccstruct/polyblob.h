@@ -61,6 +61,10 @@ class PBLOB:public ELIST_LINK
                const float f);  // by multiplier
     void scale(                    // scale blob
                const FCOORD vec);  // by FLOAT vector
+                                 //move, scale, move
+    void move_scale_move(const FCOORD pre_vec,    //first move
+                         const FCOORD factor,     //then scale
+                         const FCOORD post_vec);  //then move
 
     void prep_serialise() {  //set ptrs to counts
       outlines.prep_serialise ();
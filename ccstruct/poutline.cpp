@@ -361,6 +361,53 @@ void OUTLINE::scale(                     // scale OUTLINE
 }
 
 
+/**********************************************************************
+ * OUTLINE::move_scale_move
+ *
+ * Same as move (pre_vec), scale (factor), move (post_vec), with the same
+ * rounding, but in one pass over the points.
+ **********************************************************************/
+
+void OUTLINE::move_scale_move(                        //transform OUTLINE
+                              const FCOORD pre_vec,   //first move
+                              const FCOORD factor,    //then scale
+                              const FCOORD post_vec   //then move
+                             ) {
+                                 //child outline itertr
+  OUTLINE_IT child_it(&children); 
+  POLYPT_IT poly_it(&outline);  //outline point itertr
+  POLYPT *pt;
+  float x, y;                    //new position
+
+  box.move (pre_vec);
+  box.scale (factor);
+  box.move (post_vec);
+
+  start.set_x ((INT16) floor (start.x () + pre_vec.x () + 0.5));
+  start.set_y ((INT16) floor (start.y () + pre_vec.y () + 0.5));
+  start.set_x ((INT16) floor (start.x () * factor.x () + 0.5));
+  start.set_y ((INT16) floor (start.y () * factor.y () + 0.5));
+  start.set_x ((INT16) floor (start.x () + post_vec.x () + 0.5));
+  start.set_y ((INT16) floor (start.y () + post_vec.y () + 0.5));
+
+  for (poly_it.mark_cycle_pt (); !poly_it.cycled_list (); poly_it.forward ()) {
+    pt = poly_it.data ();
+    x = pt->pos.x () + pre_vec.x ();
+    y = pt->pos.y () + pre_vec.y ();
+    x *= factor.x ();
+    y *= factor.y ();
+    pt->pos = FCOORD (x + post_vec.x (), y + post_vec.y ());
+    pt->vec =
+      FCOORD (pt->vec.x () * factor.x (), pt->vec.y () * factor.y ());
+  }
+
+  for (child_it.mark_cycle_pt (); !child_it.cycled_list ();
+    child_it.forward ())
+                                 //transform children
+  child_it.data ()->move_scale_move (pre_vec, factor, post_vec);
+}
+
+
 /**********************************************************************
  * OUTLINE::plot
  *
@@ -80,6 +80,10 @@ class OUTLINE:public ELIST_LINK
                const float f);  // by multiplier
     void scale(                    // scale outline
                const FCOORD vec);  // by FLOAT vector
+                                 //move, scale, move
+    void move_scale_move(const FCOORD pre_vec,    //first move
+                         const FCOORD factor,     //then scale
+                         const FCOORD post_vec);  //then move
 
     void plot(                 //draw one
               WINDOW window,   //window to draw in
@@ -510,8 +510,6 @@ void WERD::baseline_normalise_x(                 // Tess style BL Norm
     blob_it.forward ()) {
       blob = blob_it.data ();
       blob_box = blob->bounding_box ();
-      blob->move (FCOORD (-antidote.origin (),
-        -blob_box.bottom ()));
       factor = bln_x_height * 4.0f / (3 * blob_box.height ());
       // Constrain the scale factor as target numbers should be either
       // cap height already or xheight.
@@ -519,8 +517,9 @@ void WERD::baseline_normalise_x(                 // Tess style BL Norm
         factor = antidote.scale();
       else if (factor > antidote.scale() * 1.5f)
         factor = antidote.scale() * 1.5f;
-      blob->scale (factor);
-      blob->move (FCOORD (0.0, bln_baseline_offset));
+      blob->move_scale_move (FCOORD (-antidote.origin (),
+        -blob_box.bottom ()), FCOORD (factor, factor),
+        FCOORD (0.0, bln_baseline_offset));
       segs[segments].xstart = blob->bounding_box().left();
       segs[segments].ycoord = blob_box.bottom();
       segs[segments++].scale_factor = factor;
@@ -535,10 +534,10 @@ void WERD::baseline_normalise_x(                 // Tess style BL Norm
     blob_it.forward ()) {
       blob = blob_it.data ();
       blob_box = blob->bounding_box ();
-      blob->move (FCOORD (-antidote.origin (),
-                          -blob_box.bottom ()));
-      blob->scale (bln_x_height * 4.0f / (3 * blob_box.height ()));
-      blob->move (FCOORD (0.0, bln_baseline_offset));
+      factor = bln_x_height * 4.0f / (3 * blob_box.height ());
+      blob->move_scale_move (FCOORD (-antidote.origin (),
+        -blob_box.bottom ()), FCOORD (factor, factor),
+        FCOORD (0.0, bln_baseline_offset));
     }
   }
   else if (bln_blshift_maxshift < 0) {
@@ -548,10 +547,10 @@ void WERD::baseline_normalise_x(                 // Tess style BL Norm
       blob_box = blob->bounding_box ();
       blob_x_centre = blob_box.left () +
         (blob_box.right () - blob_box.left ()) / 2.0;
-      blob->move (FCOORD (-antidote.origin (),
-        -(row->base_line (blob_x_centre))));
-      blob->scale (antidote.scale ());
-      blob->move (FCOORD (0.0, bln_baseline_offset));
+      blob->move_scale_move (FCOORD (-antidote.origin (),
+        -(row->base_line (blob_x_centre))),
+        FCOORD (antidote.scale (), antidote.scale ()),
+        FCOORD (0.0, bln_baseline_offset));
     }
 
                                  //Repeat for rej blobs
@@ -562,10 +561,10 @@ void WERD::baseline_normalise_x(                 // Tess style BL Norm
       blob_box = blob->bounding_box ();
       blob_x_centre = blob_box.left () +
         (blob_box.right () - blob_box.left ()) / 2.0;
-      blob->move (FCOORD (-antidote.origin (),
-        -(row->base_line (blob_x_centre))));
-      blob->scale (antidote.scale ());
-      blob->move (FCOORD (0.0, bln_baseline_offset));
+      blob->move_scale_move (FCOORD (-antidote.origin (),
+        -(row->base_line (blob_x_centre))),
+        FCOORD (antidote.scale (), antidote.scale ()),
+        FCOORD (0.0, bln_baseline_offset));
     }
 
   }
@@ -665,10 +664,9 @@ void WERD::baseline_normalise_x(                 // Tess style BL Norm
       //                      printf("Blob sf=%g, top=%d, bot=%d, base=%g\n",
       //                              segs[segments].scale_factor,blob_box.top(),
       //                              blob_box.bottom(),blob_offset);
-      blob->move (FCOORD (-antidote.origin (), -blob_offset));
-      blob->
-        scale (FCOORD (antidote.scale (), segs[segments].scale_factor));
-      blob->move (FCOORD (0.0, bln_baseline_offset));
+      blob->move_scale_move (FCOORD (-antidote.origin (), -blob_offset),
+        FCOORD (antidote.scale (), segs[segments].scale_factor),
+        FCOORD (0.0, bln_baseline_offset));
       segments++;
     }
 
@@ -690,10 +688,9 @@ void WERD::baseline_normalise_x(                 // Tess style BL Norm
         blob_offset = row->base_line (blob_x_centre);
       else
         blob_offset = line_m * blob_x_centre + line_c;
-      blob->move (FCOORD (-antidote.origin (), -blob_offset));
-      blob->
-        scale (FCOORD (antidote.scale (), segs[segment].scale_factor));
-      blob->move (FCOORD (0.0, bln_baseline_offset));
+      blob->move_scale_move (FCOORD (-antidote.origin (), -blob_offset),
+        FCOORD (antidote.scale (), segs[segment].scale_factor),
+        FCOORD (0.0, bln_baseline_offset));
     }
     if (line.count () > 0 || x_count > 1)
       antidote = DENORM (antidote.origin (), antidote.scale (),
@@ -51,7 +51,8 @@ INT32 hash(               //hash function
     }
     hcode ^= keybits & mask;     //key new key
     keybits >>= bits;
+    bitindex -= bits;            //bits left in buffer
   }
-  while (keysize > 0);
+  while (keysize > 0 || keybits != 0);
   return hcode;                  //initial hash
 }
@@ -37,6 +37,8 @@
 EXTERN DLLSYM STRING datadir;    //dir for data files
                                  //name of image
 EXTERN DLLSYM STRING imagebasename;
+                                 //vars set by configs
+EXTERN DLLSYM VAR_SNAPSHOT config_snapshot;
 EXTERN BOOL_VAR (m_print_variables, FALSE,
 "Print initial values of all variables");
 EXTERN STRING_VAR (m_data_sub_dir, "tessdata/", "Directory for data files");
@@ -49,6 +51,7 @@ static const ERRCODE USAGE = "Usage";
  * main_setup
  *
  * Main for mithras demo program. Read the arguments and set up globals.
+ * The variables set by the config files are kept in config_snapshot.
  **********************************************************************/
 
 void main_setup(                         /*main demo program */
@@ -64,6 +67,7 @@ void main_setup(                         /*main demo program */
   STRING varfile;                /*name of file */
 
   imagebasename = basename;      /*name of image */
+  config_snapshot.clear ();
   if (getpath (argv0, datadir) < 0)
   #ifdef __UNIX__
     CANTOPENFILE.error ("main", ABORT, "%s to get path", argv[0]);
@@ -93,7 +97,7 @@ void main_setup(                         /*main demo program */
     }
                                  /*actual name */
     varfile += argv[arg] + offset;
-    read_variables_file (varfile.string ());
+    config_snapshot.read_config (varfile.string ());
   }
 
   if (m_print_variables)
@@ -35,6 +35,8 @@
 extern DLLSYM STRING datadir;    //dir for data files
                                  //name of image
 extern DLLSYM STRING imagebasename;
+                                 //vars set by configs
+extern DLLSYM VAR_SNAPSHOT config_snapshot;
 extern BOOL_VAR_H (m_print_variables, FALSE,
 "Print initial values of all variables");
 extern STRING_VAR_H (m_data_sub_dir, "data/", "Directory for data files");
@@ -36,35 +36,51 @@ DLLSYM STRING_VAR (debug_file, "", "File to send tprintf output to");
 DLLSYM BOOL_VAR (debug_window_on, FALSE,
 "Send tprintf to window unless file set");
 
+DLLSYM INT_VAR (debug_repeat_limit, 10,
+"Times each counted warning is printed before it is only counted");
+
+                                 //all counters
+static TPRINTF_COUNTER *tprintf_counters = NULL;
+
 DLLSYM void
 tprintf (                        //Trace printf
 const char *format, ...          //special message
 ) {
   va_list args;                  //variable args
+
+  va_start(args, format);  //variable list
+  vtprintf(format, args);
+  va_end(args);
+}
+
+
+/*************************************************************************
+ * vtprintf()
+ * The body of tprintf, for callers that already have a va_list.
+ * Output to a file or stderr is formatted straight into the stream;
+ * only the window and trace outputs need a formatted message.
+ *************************************************************************/
+
+DLLSYM void
+vtprintf (                       //Trace printf
+const char *format,              //special message
+va_list args                     //variable args
+) {
   static FILE *debugfp = NULL;   //debug file
                                  //debug window
   static DEBUG_WIN *debugwin = NULL;
-  INT32 offset = 0;              //into message
   static char msg[MAX_MSG_LEN + 1];
+  BOOL8 file_set;                //debug_file non-empty
 
-  va_start(args, format);  //variable list
-  #ifdef __MSW32__
-                                 //Format into msg
-  offset += _vsnprintf (msg + offset, MAX_MSG_LEN - offset, format, args);
-  #else
-                                 //Format into msg
-  offset += vsprintf (msg + offset, format, args);
-  #endif
-  va_end(args);
-
-  if (debugfp == NULL && strlen (debug_file.string ()) > 0)
+  file_set = debug_file.string ()[0] != '\0';
+  if (debugfp == NULL && file_set)
     debugfp = fopen (debug_file.string (), "w");
-  else if (debugfp != NULL && strlen (debug_file.string ()) == 0) {
+  else if (debugfp != NULL && !file_set) {
     fclose(debugfp);
     debugfp = NULL;
   }
   if (debugfp != NULL)
-    fprintf (debugfp, "%s", msg);
+    vfprintf(debugfp, format, args);
   else {
 
     if (debug_window_on) {
@@ -74,25 +90,82 @@ const char *format, ...          //special message
                                  //in pixels
           DEBUG_WIN_XSIZE, DEBUG_WIN_YSIZE,
           debug_lines);
+      #ifdef __MSW32__
+      _vsnprintf (msg, MAX_MSG_LEN, format, args);
+      #else
+      vsnprintf (msg, MAX_MSG_LEN + 1, format, args);
+      #endif
+      msg[MAX_MSG_LEN] = '\0';
       debugwin->dprintf (msg);
     }
     else {
       #ifdef __UNIX__
                                  // output to stderr - like it used to
-      fprintf (stderr, "%s", msg);
+      vfprintf(stderr, format, args);
       #endif
 
       #ifdef __MSW32__
+      _vsnprintf (msg, MAX_MSG_LEN, format, args);
+      msg[MAX_MSG_LEN] = '\0';
       TRACE ("%s", msg);         //Visual C++2.0 macro
       #endif
       #ifdef __MAC__
-      printf ("%s", msg);        //Visual C++2.0 macro
+      vprintf(format, args);  //Visual C++2.0 macro
       #endif
     }
   }
 }
 
 
+/*************************************************************************
+ * TPRINTF_COUNTER::TPRINTF_COUNTER
+ * Counters are static objects, so they are chained together here at
+ * startup for print_tprintf_counters.
+ *************************************************************************/
+
+TPRINTF_COUNTER::TPRINTF_COUNTER(                  //constructor
+                                 const char *name  //what is counted
+                                ) {
+  counter_name = name;
+  hits = 0;
+  next = tprintf_counters;
+  tprintf_counters = this;
+}
+
+
+/*************************************************************************
+ * TPRINTF_COUNTER::count
+ * Count one more occurrence. Returns TRUE while the message should
+ * still be printed, ie for the first debug_repeat_limit occurrences
+ * since the counters were last printed.
+ *************************************************************************/
+
+BOOL8 TPRINTF_COUNTER::count() {
+  hits++;
+  return hits <= debug_repeat_limit;
+}
+
+
+/*************************************************************************
+ * print_tprintf_counters()
+ * Report each counter that went past debug_repeat_limit, so that the
+ * messages that were not printed are at least totalled, then reset
+ * all the counters.
+ *************************************************************************/
+
+DLLSYM void print_tprintf_counters() {
+  TPRINTF_COUNTER *counter;      //current counter
+
+  for (counter = tprintf_counters; counter != NULL; counter = counter->next) {
+    if (counter->hits > debug_repeat_limit)
+      tprintf ("%s: " INT32FORMAT " times, " INT32FORMAT " not printed\n",
+        counter->counter_name, counter->hits,
+        counter->hits - debug_repeat_limit);
+    counter->hits = 0;
+  }
+}
+
+
 /*************************************************************************
  * pause_continue()
  * UI for a debugging pause - to see an intermediate state
@@ -20,15 +20,45 @@
 #ifndef           TPRINTF_H
 #define           TPRINTF_H
 
+#include          <stdarg.h>
 #include                   "varable.h"
 
 extern DLLSYM STRING_VAR_H (debug_file, "", "File to send tprintf output to");
 extern DLLSYM BOOL_VAR_H (debug_window_on, TRUE,
 "Send tprintf to window unless file set");
 
+extern DLLSYM INT_VAR_H (debug_repeat_limit, 10,
+"Times each counted warning is printed before it is only counted");
+
+/**********************************************************************
+ * TPRINTF_COUNTER
+ *
+ * Counts a warning that may be repeated many times per page, such as
+ * a table overflow. Use as a static object and print the message only
+ * if count() returns TRUE; print_tprintf_counters reports the totals.
+ **********************************************************************/
+
+class DLLSYM TPRINTF_COUNTER
+{
+  public:
+    TPRINTF_COUNTER(                    //constructor
+                    const char *name);  //what is counted
+
+    BOOL8 count();               //count and test limit
+
+    const char *counter_name;    //what is counted
+    INT32 hits;                  //times since reset
+    TPRINTF_COUNTER *next;       //chain of counters
+};
+
 DLLSYM void tprintf (            //Trace printf
 const char *format, ...          //special message
 );
+DLLSYM void vtprintf (           //Trace printf
+const char *format,              //special message
+va_list args                     //variable args
+);
+DLLSYM void print_tprintf_counters();
                                  //special message
 DLLSYM BOOL8 pause_continue (const char *format, ...
 );
@@ -25,11 +25,29 @@
 //#include                                      "ipeerr.h"
 #include          "varable.h"
 #include          "scanutils.h"
+#include          "hashfn.h"
 
 #define PLUS          '+'        //flag states
 #define MINUS         '-'
 #define EQUAL         '='
 
+#define VAR_INDEX_MIN_BITS  8        //smallest name index
+#define VAR_SNAPSHOT_MAGIC  0x56534e50  //"VSNP" file tag
+
+struct VAR_INDEX_ENTRY           //one slot of name index
+{
+  const char *name;              //NULL if slot free
+  char type;                     //VAR_INT etc
+  void *var;                     //the *_VARIABLE
+};
+
+static VAR_INDEX_ENTRY *var_index = NULL;
+static INT32 var_index_bits = 0; //log2 table size
+                                 //FALSE if vars added
+static BOOL8 var_index_valid = FALSE;
+
+static BOOL8 read_variables_to(const char *file, VAR_SNAPSHOT *snapshot);
+
 CLISTIZE (INT_VARIABLE)
 CLISTIZE (BOOL_VARIABLE) CLISTIZE (STRING_VARIABLE) CLISTIZE (double_VARIABLE)
 INT_VAR_FROM
@@ -113,6 +131,7 @@ INT_VARIABLE::INT_VARIABLE(                     //constructor
   name = vname;                  //strings must be static
   info = comment;
   it.add_before_stay_put (this); //add it to stack
+  var_index_valid = FALSE;       //index needs rebuild
 }
 
 
@@ -123,6 +142,7 @@ INT_VARIABLE::~INT_VARIABLE (    //constructor
   for (it.mark_cycle_pt (); !it.cycled_list (); it.forward ())
     if (it.data () == this)
       it.extract ();
+  var_index_valid = FALSE;       //index needs rebuild
 }
 
 
@@ -223,6 +243,7 @@ BOOL_VARIABLE::BOOL_VARIABLE(                     //constructor
   name = vname;                  //strings must be static
   info = comment;
   it.add_before_stay_put (this); //add it to stack
+  var_index_valid = FALSE;       //index needs rebuild
 
 }
 
@@ -239,6 +260,7 @@ BOOL_VARIABLE::~BOOL_VARIABLE () {
   for (it.mark_cycle_pt (); !it.cycled_list (); it.forward ())
     if (it.data () == this)
       it.extract ();
+  var_index_valid = FALSE;       //index needs rebuild
 }
 
 
@@ -342,6 +364,7 @@ value(v) {
   name = vname;                  //strings must be static
   info = comment;
   it.add_before_stay_put (this); //add it to stack
+  var_index_valid = FALSE;       //index needs rebuild
 }
 
 
@@ -360,6 +383,7 @@ STRING_VARIABLE::~STRING_VARIABLE (
   for (it.mark_cycle_pt (); !it.cycled_list (); it.forward ())
     if (it.data () == this)
       it.extract ();
+  var_index_valid = FALSE;       //index needs rebuild
 }
 
 
@@ -462,6 +486,7 @@ double_VARIABLE::double_VARIABLE(                     //constructor
   name = vname;                  //strings must be static
   info = comment;
   it.add_before_stay_put (this); //add it to stack
+  var_index_valid = FALSE;       //index needs rebuild
 }
 
 
@@ -472,6 +497,7 @@ double_VARIABLE::~double_VARIABLE () {
   for (it.mark_cycle_pt (); !it.cycled_list (); it.forward ())
     if (it.data () == this)
       it.extract ();
+  var_index_valid = FALSE;       //index needs rebuild
 }
 
 
@@ -516,6 +542,98 @@ void double_VARIABLE::print(          //print full list
 }
 
 
+/**********************************************************************
+ * build_var_index
+ *
+ * Rebuild the hashed name index over all four variable lists.
+ * Where a name occurs twice in one list the first entry wins, as it
+ * did with the linear search.
+ **********************************************************************/
+
+static void add_to_var_index(            //add one variable
+                             char type,  //VAR_INT etc
+                             const char *name,
+                             void *var) {
+  INT32 mask = (1 << var_index_bits) - 1;
+  INT32 index;                   //hash slot
+
+  index = hash (var_index_bits, (void *) name, strlen (name));
+  while (var_index[index].name != NULL) {
+    if (var_index[index].type == type
+      && strcmp (var_index[index].name, name) == 0)
+      return;                    //keep first one
+    index = (index + 1) & mask;  //linear rehash
+  }
+  var_index[index].name = name;
+  var_index[index].type = type;
+  var_index[index].var = var;
+}
+
+
+static void build_var_index() {  //make name index
+  INT_VARIABLE_C_IT int_it = INT_VARIABLE::get_head ();
+  BOOL_VARIABLE_C_IT BOOL_it = BOOL_VARIABLE::get_head ();
+  STRING_VARIABLE_C_IT STRING_it = STRING_VARIABLE::get_head ();
+  double_VARIABLE_C_IT double_it = double_VARIABLE::get_head ();
+  INT32 var_count;               //total variables
+  INT32 index;                   //slot index
+
+  var_count = int_it.length () + BOOL_it.length ()
+    + STRING_it.length () + double_it.length ();
+  for (var_index_bits = VAR_INDEX_MIN_BITS;
+    (1 << var_index_bits) < var_count * 2; var_index_bits++);
+  if (var_index != NULL)
+    delete[]var_index;
+  var_index = new VAR_INDEX_ENTRY[1 << var_index_bits];
+  for (index = 0; index < (1 << var_index_bits); index++)
+    var_index[index].name = NULL;
+
+  for (int_it.mark_cycle_pt (); !int_it.cycled_list (); int_it.forward ())
+    add_to_var_index (VAR_INT, int_it.data ()->name_str (), int_it.data ());
+  for (BOOL_it.mark_cycle_pt (); !BOOL_it.cycled_list (); BOOL_it.forward ())
+    add_to_var_index (VAR_BOOL, BOOL_it.data ()->name_str (),
+      BOOL_it.data ());
+  for (STRING_it.mark_cycle_pt (); !STRING_it.cycled_list ();
+    STRING_it.forward ())
+  add_to_var_index (VAR_STRING, STRING_it.data ()->name_str (),
+      STRING_it.data ());
+  for (double_it.mark_cycle_pt (); !double_it.cycled_list ();
+    double_it.forward ())
+  add_to_var_index (VAR_DOUBLE, double_it.data ()->name_str (),
+      double_it.data ());
+  var_index_valid = TRUE;
+}
+
+
+/**********************************************************************
+ * find_variable
+ *
+ * Find the variable of the given type and name through the hashed
+ * index, rebuilding it first if variables have come or gone.
+ * Returns NULL if there is no such variable.
+ **********************************************************************/
+
+DLLSYM void *find_variable(                  //hashed name lookup
+                           char type,        //VAR_INT etc
+                           const char *name  //name to find
+                          ) {
+  INT32 mask;                    //table size mask
+  INT32 index;                   //hash slot
+
+  if (!var_index_valid)
+    build_var_index();
+  mask = (1 << var_index_bits) - 1;
+  index = hash (var_index_bits, (void *) name, strlen (name));
+  while (var_index[index].name != NULL) {
+    if (var_index[index].type == type
+      && strcmp (var_index[index].name, name) == 0)
+      return var_index[index].var;
+    index = (index + 1) & mask;
+  }
+  return NULL;
+}
+
+
 /**********************************************************************
  * read_variables_file
  *
@@ -524,11 +642,28 @@ void double_VARIABLE::print(          //print full list
  * ORed or ANDed with any current values.
  * Blank lines and lines beginning # are ignored.
  * Values may have any whitespace after the name and are the rest of line.
+ * A binary file written by VAR_SNAPSHOT::serialise is applied as it is,
+ * without any text parsing; the + and - flags do not apply to it.
  **********************************************************************/
 
 DLLSYM BOOL8 read_variables_file(                  //read the file
                                  const char *file  //name to read
                                 ) {
+  return read_variables_to (file, NULL);
+}
+
+
+/**********************************************************************
+ * read_variables_to
+ *
+ * As read_variables_file, but also note every variable set in the
+ * snapshot, if there is one.
+ **********************************************************************/
+
+static BOOL8 read_variables_to(                        //read the file
+                               const char *file,       //name to read
+                               VAR_SNAPSHOT *snapshot  //record or NULL
+                              ) {
   BOOL8 anyerr;                  //true if any error
   char flag;                     //file flag
   BOOL8 foundit;                 //found variable
@@ -539,12 +674,13 @@ DLLSYM BOOL8 read_variables_file(                  //read the file
   FILE *fp;                      //file pointer
   INT32 intval;                  //value from file
   double doubleval;              //value form file
-                                 //iterators
-  INT_VARIABLE_C_IT int_it = &INT_VARIABLE::head;
-  BOOL_VARIABLE_C_IT BOOL_it = &BOOL_VARIABLE::head;
-  STRING_VARIABLE_C_IT STRING_it = &STRING_VARIABLE::head;
-  double_VARIABLE_C_IT double_it = &double_VARIABLE::head;
+  INT_VARIABLE *int_var;         //found variables
+  BOOL_VARIABLE *BOOL_var;
+  STRING_VARIABLE *STRING_var;
+  double_VARIABLE *double_var;
   char line[MAX_PATH];           //input line
+  INT32 magic;                   //snapshot tag
+  VAR_SNAPSHOT file_snapshot;    //if file is binary
 
   anyerr = FALSE;
   if (*file == PLUS) {
@@ -560,6 +696,26 @@ DLLSYM BOOL8 read_variables_file(                  //read the file
     nameoffset = 0;
   }
 
+  fp = fopen (file + nameoffset, "rb");
+  if (fp == NULL) {
+    tprintf ("read_variables_file:Can't open %s", file + nameoffset);
+    return TRUE;                 //can't open it
+  }
+  if (fread (&magic, sizeof (magic), 1, fp) == 1
+  && magic == VAR_SNAPSHOT_MAGIC) {
+    rewind(fp);                  //binary snapshot
+    if (!file_snapshot.de_serialise (fp)) {
+      fclose(fp);
+      tprintf ("read_variables_file:Bad snapshot %s\n", file + nameoffset);
+      return TRUE;
+    }
+    fclose(fp);
+    file_snapshot.apply ();
+    if (snapshot != NULL)
+      snapshot->add_all (&file_snapshot);
+    return FALSE;
+  }
+  fclose(fp);                    //text file
   fp = fopen (file + nameoffset, "r");
   if (fp == NULL) {
     tprintf ("read_variables_file:Can't open %s", file + nameoffset);
@@ -599,41 +755,45 @@ DLLSYM BOOL8 read_variables_file(                  //read the file
       foundit = FALSE;
 
                                  //find name
-      for (STRING_it.mark_cycle_pt (); !STRING_it.cycled_list () && strcmp (line, STRING_it.data ()->name); STRING_it.forward ());
+      STRING_var = (STRING_VARIABLE *) find_variable (VAR_STRING, line);
                                  //found it
-      if (!STRING_it.cycled_list ()) {
+      if (STRING_var != NULL) {
         foundit = TRUE;          //found the varaible
         if (*valptr == '\0' || *valptr == '#')
-          STRING_it.data ()->set_value ((char *) NULL);
+          STRING_var->set_value ((char *) NULL);
         //no value
         else
                                  //set its value
-          STRING_it.data ()->set_value (valptr);
+          STRING_var->set_value (valptr);
+        if (snapshot != NULL)
+          snapshot->add (VAR_STRING, STRING_var);
       }
 
       if (*valptr) {
                                  //find name
-        for (int_it.mark_cycle_pt (); !int_it.cycled_list () && strcmp (line, int_it.data ()->name); int_it.forward ());
+        int_var = (INT_VARIABLE *) find_variable (VAR_INT, line);
                                  //found it
-        if (!int_it.cycled_list ()
+        if (int_var != NULL
         && sscanf (valptr, INT32FORMAT, &intval) == 1) {
           foundit = TRUE;        //found the varaible
                                  //set its value
-          int_it.data ()->set_value (intval);
+          int_var->set_value (intval);
+          if (snapshot != NULL)
+            snapshot->add (VAR_INT, int_var);
         }
 
                                  //find name
-        for (BOOL_it.mark_cycle_pt (); !BOOL_it.cycled_list () && strcmp (line, BOOL_it.data ()->name); BOOL_it.forward ());
+        BOOL_var = (BOOL_VARIABLE *) find_variable (VAR_BOOL, line);
                                  //found it
-        if (!BOOL_it.cycled_list ()) {
+        if (BOOL_var != NULL) {
           if (*valptr == 'T' || *valptr == 't'
           || *valptr == 'Y' || *valptr == 'y' || *valptr == '1') {
             foundit = TRUE;
             if (flag == MINUS)
-              BOOL_it.data ()->set_value (FALSE);
+              BOOL_var->set_value (FALSE);
             //set to false
             else
-              BOOL_it.data ()->set_value (TRUE);
+              BOOL_var->set_value (TRUE);
             //set to true
           }
           else if (*valptr == 'F' || *valptr == 'f'
@@ -641,25 +801,29 @@ DLLSYM BOOL8 read_variables_file(                  //read the file
           || *valptr == '0') {
             foundit = TRUE;
             if (flag == EQUAL)
-              BOOL_it.data ()->set_value (FALSE);
+              BOOL_var->set_value (FALSE);
             //set to false
           }
+          if (foundit && snapshot != NULL)
+            snapshot->add (VAR_BOOL, BOOL_var);
         }
 
                                  //find name
-        for (double_it.mark_cycle_pt (); !double_it.cycled_list () && strcmp (line, double_it.data ()->name); double_it.forward ());
+        double_var = (double_VARIABLE *) find_variable (VAR_DOUBLE, line);
                                  //found it
         
         #ifdef EMBEDDED
-        if (!double_it.cycled_list ()) {
+        if (double_var != NULL) {
           doubleval = strtofloat(valptr);
         #else
-        if (!double_it.cycled_list ()
+        if (double_var != NULL
         && sscanf (valptr, "%lf", &doubleval) == 1) {
         #endif
           foundit = TRUE;        //found the varaible
-          double_it.data ()->set_value (doubleval);
+          double_var->set_value (doubleval);
           //set its value
+          if (snapshot != NULL)
+            snapshot->add (VAR_DOUBLE, double_var);
         }
 
         if (!foundit) {
@@ -693,3 +857,328 @@ DLLSYM void print_variables(          //print all vars
   STRING_VARIABLE::print(fp);  //print STRINGs
   double_VARIABLE::print(fp);  //print doubles
 }
+
+
+/**********************************************************************
+ * VAR_SNAPSHOT::VAR_SNAPSHOT
+ *
+ * Constructor for an empty snapshot.
+ **********************************************************************/
+
+VAR_SNAPSHOT::VAR_SNAPSHOT() {  //constructor
+  count = 0;
+  size = 0;
+  types = NULL;
+  vars = NULL;
+  int_values = NULL;
+  double_values = NULL;
+  string_values = NULL;
+}
+
+
+VAR_SNAPSHOT::~VAR_SNAPSHOT () {
+  clear();
+}
+
+
+/**********************************************************************
+ * VAR_SNAPSHOT::clear
+ *
+ * Forget all overrides and free the arrays.
+ **********************************************************************/
+
+void VAR_SNAPSHOT::clear() {  //empty it
+  if (size > 0) {
+    delete[]types;
+    delete[]vars;
+    delete[]int_values;
+    delete[]double_values;
+    delete[]string_values;
+  }
+  count = 0;
+  size = 0;
+  types = NULL;
+  vars = NULL;
+  int_values = NULL;
+  double_values = NULL;
+  string_values = NULL;
+}
+
+
+/**********************************************************************
+ * VAR_SNAPSHOT::add
+ *
+ * Note that the given variable is overridden and return its entry.
+ * Its value is taken later by capture. Entries are only appended, so a
+ * variable set twice has two entries with the same captured value and
+ * apply gives the same result either way.
+ **********************************************************************/
+
+INT32 VAR_SNAPSHOT::add(            //note override
+                        char type,  //VAR_INT etc
+                        void *var   //variable set
+                       ) {
+  INT32 index;                   //entry index
+  INT32 new_size;                //grown size
+  char *new_types;               //grown arrays
+  void **new_vars;
+  INT32 *new_ints;
+  double *new_doubles;
+  STRING *new_strings;
+
+  if (count == size) {
+    new_size = size > 0 ? size * 2 : 16;
+    new_types = new char[new_size];
+    new_vars = new void *[new_size];
+    new_ints = new INT32[new_size];
+    new_doubles = new double[new_size];
+    new_strings = new STRING[new_size];
+    for (index = 0; index < count; index++) {
+      new_types[index] = types[index];
+      new_vars[index] = vars[index];
+      new_ints[index] = int_values[index];
+      new_doubles[index] = double_values[index];
+      new_strings[index] = string_values[index];
+    }
+    if (size > 0) {
+      delete[]types;
+      delete[]vars;
+      delete[]int_values;
+      delete[]double_values;
+      delete[]string_values;
+    }
+    types = new_types;
+    vars = new_vars;
+    int_values = new_ints;
+    double_values = new_doubles;
+    string_values = new_strings;
+    size = new_size;
+  }
+  types[count] = type;
+  vars[count] = var;
+  return count++;
+}
+
+
+/**********************************************************************
+ * VAR_SNAPSHOT::add_all
+ *
+ * Add every entry of another snapshot, with its value.
+ **********************************************************************/
+
+void VAR_SNAPSHOT::add_all(                       //merge snapshot
+                           VAR_SNAPSHOT *other    //entries to add
+                          ) {
+  INT32 index;                   //entry in other
+  INT32 entry;                   //entry in this
+
+  for (index = 0; index < other->count; index++) {
+    entry = add (other->types[index], other->vars[index]);
+    int_values[entry] = other->int_values[index];
+    double_values[entry] = other->double_values[index];
+    string_values[entry] = other->string_values[index];
+  }
+}
+
+
+/**********************************************************************
+ * VAR_SNAPSHOT::capture
+ *
+ * Copy the current values of all the recorded variables.
+ **********************************************************************/
+
+void VAR_SNAPSHOT::capture() {  //take values
+  INT32 index;                   //entry index
+
+  for (index = 0; index < count; index++) {
+    switch (types[index]) {
+      case VAR_INT:
+        int_values[index] = *(INT_VARIABLE *) vars[index];
+        break;
+      case VAR_BOOL:
+        int_values[index] = *(BOOL_VARIABLE *) vars[index];
+        break;
+      case VAR_DOUBLE:
+        double_values[index] = *(double_VARIABLE *) vars[index];
+        break;
+      case VAR_STRING:
+        string_values[index] = ((STRING_VARIABLE *) vars[index])->string ();
+        break;
+    }
+  }
+}
+
+
+/**********************************************************************
+ * VAR_SNAPSHOT::read_config
+ *
+ * Read a variables file exactly as read_variables_file does, and add
+ * the variables it set to the snapshot with their resulting values.
+ * May be called for several files in turn to build one snapshot.
+ **********************************************************************/
+
+BOOL8 VAR_SNAPSHOT::read_config(                  //read and record
+                                const char *file  //name to read
+                               ) {
+  BOOL8 anyerr;                  //true if any error
+
+  anyerr = read_variables_to (file, this);
+  capture();
+  return anyerr;
+}
+
+
+/**********************************************************************
+ * VAR_SNAPSHOT::apply
+ *
+ * Set every recorded variable to its snapshot value.
+ **********************************************************************/
+
+void VAR_SNAPSHOT::apply() {  //set overrides
+  INT32 index;                   //entry index
+
+  for (index = 0; index < count; index++) {
+    switch (types[index]) {
+      case VAR_INT:
+        ((INT_VARIABLE *) vars[index])->set_value (int_values[index]);
+        break;
+      case VAR_BOOL:
+        ((BOOL_VARIABLE *) vars[index])->set_value ((BOOL8)
+          int_values[index]);
+        break;
+      case VAR_DOUBLE:
+        ((double_VARIABLE *) vars[index])->set_value (double_values[index]);
+        break;
+      case VAR_STRING:
+        ((STRING_VARIABLE *) vars[index])->set_value (string_values[index]);
+        break;
+    }
+  }
+}
+
+
+/**********************************************************************
+ * VAR_SNAPSHOT::serialise
+ *
+ * Write the snapshot as a magic number and count, then per entry the
+ * type, the variable name and the value. The format is native byte
+ * order, for caching on the machine that made it.
+ **********************************************************************/
+
+BOOL8 VAR_SNAPSHOT::serialise(          //write binary form
+                              FILE *fp  //file to write
+                             ) {
+  INT32 index;                   //entry index
+  INT32 magic = VAR_SNAPSHOT_MAGIC;
+  INT32 length;                  //of name or string
+  const char *name;              //variable name
+
+  if (fwrite (&magic, sizeof (magic), 1, fp) != 1
+    || fwrite (&count, sizeof (count), 1, fp) != 1)
+    return FALSE;
+  for (index = 0; index < count; index++) {
+    switch (types[index]) {
+      case VAR_INT:
+        name = ((INT_VARIABLE *) vars[index])->name_str ();
+        break;
+      case VAR_BOOL:
+        name = ((BOOL_VARIABLE *) vars[index])->name_str ();
+        break;
+      case VAR_DOUBLE:
+        name = ((double_VARIABLE *) vars[index])->name_str ();
+        break;
+      default:
+        name = ((STRING_VARIABLE *) vars[index])->name_str ();
+        break;
+    }
+    length = strlen (name);
+    if (fwrite (&types[index], sizeof (char), 1, fp) != 1
+      || fwrite (&length, sizeof (length), 1, fp) != 1
+      || fwrite (name, sizeof (char), length, fp) != (size_t) length)
+      return FALSE;
+    if (types[index] == VAR_DOUBLE) {
+      if (fwrite (&double_values[index], sizeof (double), 1, fp) != 1)
+        return FALSE;
+    }
+    else if (types[index] == VAR_STRING) {
+      length = string_values[index].length ();
+      if (fwrite (&length, sizeof (length), 1, fp) != 1
+        || fwrite (string_values[index].string (), sizeof (char), length,
+        fp) != (size_t) length)
+        return FALSE;
+    }
+    else if (fwrite (&int_values[index], sizeof (INT32), 1, fp) != 1)
+      return FALSE;
+  }
+  return TRUE;
+}
+
+
+/**********************************************************************
+ * VAR_SNAPSHOT::de_serialise
+ *
+ * Read a snapshot written by serialise, resolving each name once
+ * through the hashed index. Unknown variables are reported and skipped.
+ * Returns FALSE if the file is not a snapshot or is truncated.
+ **********************************************************************/
+
+BOOL8 VAR_SNAPSHOT::de_serialise(          //read binary form
+                                 FILE *fp  //file to read
+                                ) {
+  INT32 index;                   //entry index
+  INT32 magic;                   //file tag
+  INT32 entries;                 //in file
+  INT32 length;                  //of name or string
+  INT32 entry;                   //snapshot index
+  char type;                     //VAR_INT etc
+  void *var;                     //found variable
+  INT32 intval;                  //values from file
+  double doubleval;
+  char name[MAX_PATH];           //variable name
+  char *strval;                  //string value
+
+  clear();
+  if (fread (&magic, sizeof (magic), 1, fp) != 1
+    || magic != VAR_SNAPSHOT_MAGIC
+    || fread (&entries, sizeof (entries), 1, fp) != 1 || entries < 0)
+    return FALSE;
+  for (index = 0; index < entries; index++) {
+    if (fread (&type, sizeof (type), 1, fp) != 1
+      || fread (&length, sizeof (length), 1, fp) != 1
+      || length < 0 || length >= MAX_PATH
+      || fread (name, sizeof (char), length, fp) != (size_t) length)
+      return FALSE;
+    name[length] = '\0';
+    var = find_variable (type, name);
+    if (var == NULL)
+      tprintf ("VAR_SNAPSHOT:variable not found: %s\n", name);
+    else
+      entry = add (type, var);
+    if (type == VAR_DOUBLE) {
+      if (fread (&doubleval, sizeof (double), 1, fp) != 1)
+        return FALSE;
+      if (var != NULL)
+        double_values[entry] = doubleval;
+    }
+    else if (type == VAR_STRING) {
+      if (fread (&length, sizeof (length), 1, fp) != 1 || length < 0)
+        return FALSE;
+      strval = new char[length + 1];
+      if (fread (strval, sizeof (char), length, fp) != (size_t) length) {
+        delete[]strval;
+        return FALSE;
+      }
+      strval[length] = '\0';
+      if (var != NULL)
+        string_values[entry] = strval;
+      delete[]strval;
+    }
+    else {
+      if (fread (&intval, sizeof (intval), 1, fp) != 1)
+        return FALSE;
+      if (var != NULL)
+        int_values[entry] = intval;
+    }
+  }
+  return TRUE;
+}
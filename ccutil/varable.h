@@ -25,6 +25,12 @@
 #include          "strngs.h"
 
 class DLLSYM INT_VARIABLE;
+class DLLSYM VAR_SNAPSHOT;
+
+#define VAR_INT       'i'        //variable types
+#define VAR_BOOL      'b'
+#define VAR_STRING    's'
+#define VAR_DOUBLE    'd'
 
                                  //read the file
 extern DLLSYM BOOL8 read_variables_file(const char *file  //name to read
@@ -32,6 +38,10 @@ extern DLLSYM BOOL8 read_variables_file(const char *file  //name to read
                                  //print all vars
 extern DLLSYM void print_variables(FILE *fp  //file to print on
                                   );
+                                 //hashed name lookup
+extern DLLSYM void *find_variable(char type,        //VAR_INT etc
+                                  const char *name  //name to find
+                                 );
 
 CLISTIZEH (INT_VARIABLE)
 class DLLSYM INT_VAR_FROM
@@ -327,6 +337,55 @@ class DLLSYM double_VARIABLE
     static double_VAR_TO replace;//post constructor
 };
 
+/**********************************************************************
+ * VAR_SNAPSHOT
+ *
+ * The resolved result of one or more variables files, held as a list of
+ * (variable, value) overrides. Reading a config into a snapshot costs the
+ * same as read_variables_file, but applying it again later only costs
+ * one assignment per override. Snapshots may be written to a compact
+ * binary file and read back without any text parsing.
+ **********************************************************************/
+
+class DLLSYM VAR_SNAPSHOT
+{
+  public:
+    VAR_SNAPSHOT();  //empty snapshot
+    ~VAR_SNAPSHOT ();
+
+    BOOL8 read_config(                   //read and record
+                      const char *file);  //name to read
+
+    void apply();  //set all overrides
+
+    BOOL8 serialise(             //write binary form
+                    FILE *fp);   //file to write
+    BOOL8 de_serialise(          //read binary form
+                       FILE *fp);  //file to read
+
+    INT32 length() {  //no of overrides
+      return count;
+    }
+
+    void clear();  //forget all overrides
+
+                                 //note var was set
+    INT32 add(char type, void *var);
+                                 //add other's entries
+    void add_all(VAR_SNAPSHOT *other);
+
+  private:
+    void capture();  //copy current values
+
+    INT32 count;                 //entries used
+    INT32 size;                  //entries allocated
+    char *types;                 //VAR_INT etc
+    void **vars;                 //the variables
+    INT32 *int_values;           //INT and BOOL values
+    double *double_values;       //double values
+    STRING *string_values;       //STRING values
+};
+
 /*************************************************************************
  * NOTE ON DEFINING VARIABLES
  *
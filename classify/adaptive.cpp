@@ -27,6 +27,12 @@
 #include <assert.h>
 #endif
 #include <stdio.h>
+#include <stddef.h>
+
+/* The config pruner is not saved with an adapted class, so the file
+format is unchanged.  It is rebuilt from the permanent configs when the
+templates are read back. */
+#define ADAPT_CLASS_FILE_SIZE offsetof (ADAPT_CLASS_STRUCT, ConfigPruner)
 
 /**----------------------------------------------------------------------------
               Public Code
@@ -68,6 +74,51 @@ int AddAdaptedClass(ADAPT_TEMPLATES Templates,
 }                                /* AddAdaptedClass */
 
 
+/*---------------------------------------------------------------------------*/
+void AddConfigToConfigPruner(ADAPT_CLASS Class,
+                             INT_CLASS IClass,
+                             int ConfigId) {
+/*
+ **	Parameters:
+ **		Class		adapted class whose config pruner is updated
+ **		IClass		integer class holding the protos of Class
+ **		ConfigId	config just made permanent
+ **	Globals: none
+ **	Operation: This routine sets the bit for ConfigId in every bucket
+ **		of the config pruner of Class that the proto pruner marks
+ **		for any proto of the config.  It is called once as each
+ **		config is made permanent, and for every permanent config
+ **		when adapted templates are read back from a file.
+ **	Return: none
+ **	Exceptions: none
+ **	History: Sun Oct 18 15:40:12 2026, Created.
+ */
+  int ProtoId;
+  int Param;
+  int Bucket;
+  int WordIndex;
+  UINT32 ProtoMask;
+  UINT32 ConfigMask;
+  PROTO_SET ProtoSet;
+
+  assert (ConfigId < MAX_NUM_CONFIGS);
+
+  ConfigMask = (UINT32) 1 << ConfigId;
+  for (ProtoId = 0; ProtoId < NumIntProtosIn (IClass); ProtoId++) {
+    if (!(ProtoForProtoId (IClass, ProtoId)->Configs[0] & ConfigMask))
+      continue;
+
+    ProtoSet = ProtoSetIn (IClass, SetForProto (ProtoId));
+    WordIndex = PPrunerWordIndexFor (ProtoId);
+    ProtoMask = PPrunerMaskFor (ProtoId);
+    for (Param = 0; Param < NUM_PP_PARAMS; Param++)
+      for (Bucket = 0; Bucket < NUM_PP_BUCKETS; Bucket++)
+        if (ProtoSet->ProtoPruner[Param][Bucket][WordIndex] & ProtoMask)
+          Class->ConfigPruner[Param][Bucket] |= ConfigMask;
+  }
+}                                /* AddConfigToConfigPruner */
+
+
 /*---------------------------------------------------------------------------*/
 void FreeTempConfig(TEMP_CONFIG Config) { 
 /*
@@ -110,10 +161,15 @@ ADAPT_CLASS NewAdaptedClass() {
  */
   ADAPT_CLASS Class;
   int i;
+  int Param;
+  int Bucket;
 
   Class = (ADAPT_CLASS) Emalloc (sizeof (ADAPT_CLASS_STRUCT));
   Class->NumPermConfigs = 0;
   Class->TempProtos = NIL;
+  for (Param = 0; Param < NUM_PP_PARAMS; Param++)
+    for (Bucket = 0; Bucket < NUM_PP_BUCKETS; Bucket++)
+      Class->ConfigPruner[Param][Bucket] = 0;
 
   Class->PermProtos = NewBitVector (MAX_NUM_PROTOS);
   Class->PermConfigs = NewBitVector (MAX_NUM_CONFIGS);
@@ -287,12 +343,17 @@ ADAPT_CLASS ReadAdaptedClass(FILE *File) {
   int NumTempProtos;
   int NumConfigs;
   int i;
+  int Param;
+  int Bucket;
   ADAPT_CLASS Class;
   TEMP_PROTO TempProto;
 
   /* first read high level adapted class structure */
   Class = (ADAPT_CLASS) Emalloc (sizeof (ADAPT_CLASS_STRUCT));
-  fread ((char *) Class, sizeof (ADAPT_CLASS_STRUCT), 1, File);
+  fread ((char *) Class, ADAPT_CLASS_FILE_SIZE, 1, File);
+  for (Param = 0; Param < NUM_PP_PARAMS; Param++)
+    for (Bucket = 0; Bucket < NUM_PP_BUCKETS; Bucket++)
+      Class->ConfigPruner[Param][Bucket] = 0;
 
   /* then read in the definitions of the permanent protos and configs */
   Class->PermProtos = NewBitVector (MAX_NUM_PROTOS);
@@ -337,8 +398,11 @@ ADAPT_TEMPLATES ReadAdaptedTemplates(FILE *File) {
  **	Return: Ptr to adapted templates read from File.
  **	Exceptions: none
  **	History: Mon Mar 18 15:18:10 1991, DSJ, Created.
+ **		 Sun Oct 18 15:40:12 2026, rebuild config pruners.
  */
   int i;
+  int ConfigId;
+  INT_CLASS IClass;
   ADAPT_TEMPLATES Templates;
 
   /* first read the high level adaptive template struct */
@@ -351,6 +415,10 @@ ADAPT_TEMPLATES ReadAdaptedTemplates(FILE *File) {
   /* then read in the adaptive info for each class */
   for (i = 0; i < NumClassesIn (Templates->Templates); i++) {
     Templates->Class[i] = ReadAdaptedClass (File);
+    IClass = ClassForIndex (Templates->Templates, i);
+    for (ConfigId = 0; ConfigId < NumIntConfigsIn (IClass); ConfigId++)
+      if (test_bit (Templates->Class[i]->PermConfigs, ConfigId))
+        AddConfigToConfigPruner (Templates->Class[i], IClass, ConfigId);
   }
   return (Templates);
 
@@ -429,7 +497,7 @@ void WriteAdaptedClass(FILE *File, ADAPT_CLASS Class, int NumConfigs) {
   int i;
 
   /* first write high level adapted class structure */
-  fwrite ((char *) Class, sizeof (ADAPT_CLASS_STRUCT), 1, File);
+  fwrite ((char *) Class, ADAPT_CLASS_FILE_SIZE, 1, File);
 
   /* then write out the definitions of the permanent protos and configs */
   fwrite ((char *) Class->PermProtos, sizeof (UINT32),
@@ -62,6 +62,7 @@ typedef struct
   BIT_VECTOR PermConfigs;
   LIST TempProtos;
   ADAPTED_CONFIG Config[MAX_NUM_CONFIGS];
+  CONFIG_PRUNER ConfigPruner;
 } ADAPT_CLASS_STRUCT;
 typedef ADAPT_CLASS_STRUCT *ADAPT_CLASS;
 
@@ -99,6 +100,10 @@ int AddAdaptedClass(ADAPT_TEMPLATES Templates,
                     ADAPT_CLASS Class,
                     CLASS_ID ClassId);
 
+void AddConfigToConfigPruner(ADAPT_CLASS Class,
+                             INT_CLASS IClass,
+                             int ConfigId);
+
 void FreeTempProto(void *arg); 
 
 void FreeTempConfig(TEMP_CONFIG Config); 
@@ -42,6 +42,7 @@
 #include "werd.h"
 #include "callcpp.h"
 #include "tordvars.h"
+#include "tprintf.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -59,7 +60,6 @@
 #define MAX_MATCHES         10
 #define UNLIKELY_NUM_FEAT 200
 #define NO_DEBUG      0
-#define MAX_ADAPTABLE_WERD_SIZE 40
 #define ADAPTABLE_WERD    (GOOD_NUMBER + 0.05)
 
 #define Y_DIM_OFFSET    (Y_SHIFT - BASELINE_Y_SHIFT)
@@ -102,6 +102,8 @@ PROTO_KEY;
 
 #define InitIntFX() (FeaturesHaveBeenExtracted = FALSE)
 
+#define InitAdaptBlob(B) (AdaptBlob = (B), AdaptBlobMatched = FALSE)
+
 /**----------------------------------------------------------------------------
           Private Function Prototypes
 ----------------------------------------------------------------------------**/
@@ -131,7 +133,9 @@ char *BaselineClassifier(TBLOB *Blob,
                          ADAPT_TEMPLATES Templates,
                          ADAPT_RESULTS *Results);
 
-void make_config_pruner(INT_TEMPLATES templates, CONFIG_PRUNER *config_pruner);
+UINT32 PruneAdaptedConfigs(ADAPT_CLASS Class,
+                           INT16 NumFeatures,
+                           INT_FEATURE_ARRAY Features);
 
 void CharNormClassifier(TBLOB *Blob,
                         LINE_STATS *LineStats,
@@ -156,6 +160,10 @@ void DoAdaptiveMatch(TBLOB *Blob,
                      LINE_STATS *LineStats,
                      ADAPT_RESULTS *Results);
 
+void GetPreTrainedMatches(TBLOB *Blob,
+                          LINE_STATS *LineStats,
+                          ADAPT_RESULTS *Results);
+
 void GetAdaptThresholds (TWERD * Word,
 LINE_STATS * LineStats,
 const char *BestChoice,
@@ -449,6 +457,7 @@ static int NumBaselineClassesTried = 0;
 static int NumCharNormClassesTried = 0;
 static int NumAmbigClassesTried = 0;
 static int NumClassesOutput = 0;
+static TPRINTF_COUNTER nil_classifications ("Nil classification");
 
 /* define globals used to hold onto extracted features.  This is used
 to map from the old scheme in which baseline features and char norm
@@ -462,6 +471,14 @@ static INT_FEATURE_ARRAY CharNormFeatures;
 //                                                      NormalizationAdjustments;
 static INT_FX_RESULT_STRUCT FXInfo;
 
+/* define globals used to hold onto the pre-trained match of the blob
+currently being adapted to.  Adapting to a blob may need this match
+both to check for punctuation ambiguities and to find the ambiguities
+of a config made permanent, so it is computed only once per blob. */
+static TBLOB *AdaptBlob = NULL;
+static BOOL8 AdaptBlobMatched = FALSE;
+static ADAPT_RESULTS AdaptBlobResults;
+
 /* use a global variable to hold onto the current ratings so that the
 comparison function passes to qsort can get at them */
 static FLOAT32 *CurrentRatings;
@@ -480,6 +497,7 @@ static ADAPT_TEMPLATES AdaptedTemplates;
 /* create dummy proto and config masks for use with the built-in templates */
 static BIT_VECTOR AllProtosOn;
 static BIT_VECTOR PrunedProtos;
+static BIT_VECTOR PrunedAdaptedProtos;
 static BIT_VECTOR AllConfigsOn;
 static BIT_VECTOR AllProtosOff;
 static BIT_VECTOR AllConfigsOff;
@@ -556,6 +574,10 @@ make_float_var (RatingScale, 30.0, MakeRatingScale,
 make_float_var (CertaintyScale, 20.0, MakeCertaintyScale,
 18, 18, SetCertaintyScale, "CertaintyScale: ");
 
+make_float_var (ConfigPruneFraction, 0.75, MakeConfigPruneFraction,
+18, 19, SetConfigPruneFraction,
+"Min fraction of best config hits to match an adapted config: ");
+
 int tess_cn_matching = 0;
 int tess_bn_matching = 0;
 
@@ -580,7 +602,8 @@ LIST AdaptiveClassifier(TBLOB *Blob, TBLOB *DotBlob, TEXTROW *Row) {
 **							Bad matches are then removed so that they don't need to be
 **							sorted.  The remaining good matches are then sorted and
 **							converted to choices.
-**							This routine also performs some simple speckle filtering.
+**							This routine also performs some simple speckle filtering,
+**							and returns only a null choice for blobs that are plainly noise.
 **							Return: List of choices found by adaptive matcher.
 **							Exceptions: none
 **							History: Mon Mar 11 10:00:58 1991, DSJ, Created.
@@ -593,6 +616,13 @@ LIST AdaptiveClassifier(TBLOB *Blob, TBLOB *DotBlob, TEXTROW *Row) {
     AdaptedTemplates = NewAdaptedTemplates ();
   EnterClassifyMode;
 
+  /* plain noise is given a null choice without running the matcher */
+  if (NoiseBlob (Blob, Row)) {
+    Choices = AddLargeSpeckleTo (NIL);
+    NumClassesOutput += count (Choices);
+    return (Choices);
+  }
+
   Results.BlobLength = MAX_FLOAT32;
   Results.NumMatches = 0;
   Results.BestRating = WORST_POSSIBLE_RATING;
@@ -626,8 +656,8 @@ LIST AdaptiveClassifier(TBLOB *Blob, TBLOB *DotBlob, TEXTROW *Row) {
 
   NumClassesOutput += count (Choices);
   if (Choices == NIL) {
-    if (!bln_numericmode)
-      printf ("Nil classification!\n");  // Should never normally happen.
+    if (!bln_numericmode && nil_classifications.count ())
+      cprintf ("Nil classification!\n");  // Should never normally happen.
     return (append_choice (NIL, "", 50.0f, -20.0f, -1));
   }
 
@@ -664,10 +694,90 @@ void AdaptToWord(TWERD *Word,
 **							Return: none
 **							Exceptions: none
 **							History: Thu Mar 14 07:40:36 1991, DSJ, Created.
+*/
+  FLOAT32 Thresholds[MAX_ADAPTABLE_WERD_SIZE];
+
+  if (GetWordAdaptThresholds (Word, Row, BestChoice, BestRawChoice,
+    Thresholds))
+    AdaptToWordWithThresholds(Word, Row, BestChoice, rejmap, Thresholds);
+}                                /* AdaptToWord */
+
+
+/*---------------------------------------------------------------------------*/
+BOOL8 GetWordAdaptThresholds(TWERD *Word,
+                             TEXTROW *Row,
+                             const char *BestChoice,
+                             const char *BestRawChoice,
+                             FLOAT32 *Thresholds) {
+/*
+ **							Parameters:
+ **							Word
+              word to be adapted to
+**							Row
+              row of text that word is found in
+**							BestChoice
+              best choice for word found by system
+**							BestRawChoice
+              best choice for word found by classifier only
+**							Thresholds
+              array of MAX_ADAPTABLE_WERD_SIZE to fill in
+**							Globals:
+**							EnableLearning
+              TRUE if learning is enabled
+**							Operation: This routine finds the adaptation threshold of each
+**							character of Word.  The thresholds depend on the state
+**							the stopper holds for the word just recognized, so they
+**							must be found straight after recognition, even if the
+**							templates are only updated later.
+**							Return: FALSE if learning is disabled, TRUE otherwise.
+**							Exceptions: none
+**							History: Sun Oct 18 11:26:05 2026, Created.
+*/
+  LINE_STATS LineStats;
+
+  if (!EnableLearning)
+    return (FALSE);
+
+  GetLineStatsFromRow(Row, &LineStats);
+  GetAdaptThresholds(Word,
+                     &LineStats,
+                     BestChoice,
+                     BestRawChoice,
+                     Thresholds);
+  return (TRUE);
+}                                /* GetWordAdaptThresholds */
+
+
+/*---------------------------------------------------------------------------*/
+void AdaptToWordWithThresholds(TWERD *Word,
+                               TEXTROW *Row,
+                               const char *BestChoice,
+                               const char *rejmap,
+                               FLOAT32 *Thresholds) {
+/*
+ **							Parameters:
+ **							Word
+              word to be adapted to
+**							Row
+              row of text that word is found in
+**							BestChoice
+              best choice for word found by system
+**							rejmap
+              '1' for each char to adapt to, or NULL for all
+**							Thresholds
+              thresholds from GetWordAdaptThresholds
+**							Globals:
+**							AdaptedTemplates
+              current set of adapted templates
+**							Operation: This routine updates the adapted templates with each
+**							acceptable character of Word, using the thresholds found
+**							when the word was recognized.
+**							Return: none
+**							Exceptions: none
+**							History: Sun Oct 18 11:26:05 2026, Created.
 */
   TBLOB *Blob;
   LINE_STATS LineStats;
-  FLOAT32 Thresholds[MAX_ADAPTABLE_WERD_SIZE];
   FLOAT32 *Threshold;
   const char *map = rejmap;
   char map_char = '1';
@@ -681,15 +791,10 @@ void AdaptToWord(TWERD *Word,
     #endif
     GetLineStatsFromRow(Row, &LineStats);
 
-    GetAdaptThresholds(Word,
-                       &LineStats,
-                       BestChoice,
-                       BestRawChoice,
-                       Thresholds);
-
     for (Blob = Word->blobs, Threshold = Thresholds;
     Blob != NULL; Blob = Blob->next, BestChoice++, Threshold++) {
       InitIntFX();
+      InitAdaptBlob(Blob);
 
       if (rejmap != NULL)
         map_char = *map++;
@@ -733,10 +838,11 @@ void AdaptToWord(TWERD *Word,
           AdaptToPunc(Blob, &LineStats, *BestChoice, *Threshold);
       }
     }
+    InitAdaptBlob(NULL);
     if (LearningDebugLevel >= 1)
       cprintf ("\n");
   }
-}                                /* AdaptToWord */
+}                                /* AdaptToWordWithThresholds */
 
 
 /*---------------------------------------------------------------------------*/
@@ -783,12 +889,14 @@ void EndAdaptiveClassifier() {
   PreTrainedTemplates = NULL;
   FreeBitVector(AllProtosOn);
   FreeBitVector(PrunedProtos);
+  FreeBitVector(PrunedAdaptedProtos);
   FreeBitVector(AllConfigsOn);
   FreeBitVector(AllProtosOff);
   FreeBitVector(AllConfigsOff);
   FreeBitVector(TempProtoMask);
   AllProtosOn = NULL;
   PrunedProtos = NULL;
+  PrunedAdaptedProtos = NULL;
   AllConfigsOn = NULL;
   AllProtosOff = NULL;
   AllConfigsOff = NULL;
@@ -863,6 +971,7 @@ void InitAdaptiveClassifier() {
 
   AllProtosOn = NewBitVector (MAX_NUM_PROTOS);
   PrunedProtos = NewBitVector (MAX_NUM_PROTOS);
+  PrunedAdaptedProtos = NewBitVector (MAX_NUM_PROTOS);
   AllConfigsOn = NewBitVector (MAX_NUM_CONFIGS);
   AllProtosOff = NewBitVector (MAX_NUM_PROTOS);
   AllConfigsOff = NewBitVector (MAX_NUM_CONFIGS);
@@ -950,6 +1059,7 @@ void InitAdaptiveClassifierVars() {
   MakeEnableNewAdaptRules();
   MakeRatingScale();
   MakeCertaintyScale();
+  MakeConfigPruneFraction();
 
   InitPicoFXVars();
   InitOutlineFXVars();  //?
@@ -1377,14 +1487,7 @@ void AdaptToPunc(TBLOB *Blob,
   ADAPT_RESULTS Results;
   int i;
 
-  Results.BlobLength = MAX_FLOAT32;
-  Results.NumMatches = 0;
-  Results.BestRating = WORST_POSSIBLE_RATING;
-  Results.BestClass = NO_CLASS;
-  Results.BestConfig = 0;
-  InitMatcherRatings (Results.Ratings);
-  CharNormClassifier(Blob, LineStats, PreTrainedTemplates, &Results);
-  RemoveBadMatches(&Results);
+  GetPreTrainedMatches(Blob, LineStats, &Results);
 
   if (Results.NumMatches != 1) {
     if (LearningDebugLevel >= 1) {
@@ -1496,9 +1599,14 @@ void AmbigClassifier(TBLOB *Blob,
 */
   int IntOutlineLength;
   int NumFeatures;
+  int NumClasses;
+  int i;
   INT_FEATURE_ARRAY IntFeatures;
   CLASS_NORMALIZATION_ARRAY CharNormArray;
-  INT_RESULT_STRUCT IntResult;
+  INT_CLASS MatchClasses[MAX_NUM_CLASSES];
+  BIT_VECTOR MatchConfigs[MAX_NUM_CLASSES];
+  UINT8 MatchNorms[MAX_NUM_CLASSES];
+  INT_RESULT_STRUCT MatchResults[MAX_NUM_CLASSES];
   CLASS_ID ClassId;
   CLASS_INDEX ClassIndex;
 
@@ -1516,23 +1624,29 @@ void AmbigClassifier(TBLOB *Blob,
   if (MatcherDebugLevel >= 2)
     cprintf ("AM Matches =  ");
 
-  while (*Ambiguities) {
-    ClassId = *Ambiguities;
+  /* all the ambiguities are matched in one call to share feature setup */
+  for (NumClasses = 0; Ambiguities[NumClasses]; NumClasses++) {
+    ClassId = Ambiguities[NumClasses];
     ClassIndex = IndexForClassId (Templates, ClassId);
+    MatchClasses[NumClasses] = ClassForClassId (Templates, ClassId);
+    MatchConfigs[NumClasses] = AllConfigsOn;
+    MatchNorms[NumClasses] = CharNormArray[ClassIndex];
+  }
 
-    SetCharNormMatch();
-    IntegerMatcher (ClassForClassId (Templates, ClassId),
-      AllProtosOn, AllConfigsOn,
-      IntOutlineLength, NumFeatures, IntFeatures, 0,
-      CharNormArray[ClassIndex], &IntResult, NO_DEBUG);
+  SetCharNormMatch();
+  IntegerMatchClasses(NumClasses, MatchClasses, AllProtosOn, MatchConfigs,
+                      MatchNorms, IntOutlineLength, NumFeatures,
+                      IntFeatures, 0, MatchResults);
 
-    if (MatcherDebugLevel >= 2)
-      cprintf ("%c-%-2d %2.0f  ", ClassId, IntResult.Config,
-        IntResult.Rating * 100.0);
+  for (i = 0; i < NumClasses; i++) {
+    ClassId = Ambiguities[i];
 
-    AddNewResult (Results, ClassId, IntResult.Rating, IntResult.Config);
+    if (MatcherDebugLevel >= 2)
+      cprintf ("%c-%-2d %2.0f  ", ClassId, MatchResults[i].Config,
+        MatchResults[i].Rating * 100.0);
 
-    Ambiguities++;
+    AddNewResult (Results, ClassId, MatchResults[i].Rating,
+      MatchResults[i].Config);
 
     NumAmbigClassesTried++;
   }
@@ -1581,6 +1695,9 @@ char *BaselineClassifier(TBLOB *Blob,
   CLASS_ID ClassId;
   CLASS_INDEX ClassIndex;
   ADAPT_CLASS Class;
+  BIT_VECTOR ProtoMask;
+  BIT_VECTOR ConfigMask;
+  UINT32 PrunedConfigs;
 
   BaselineClassifierCalls++;
 
@@ -1612,11 +1729,24 @@ char *BaselineClassifier(TBLOB *Blob,
   && NumClasses > 1); i++) {
     ClassId = ClassPrunerResults[i].Class;
     ClassIndex = IndexForClassId (Templates->Templates, ClassId);
+    Class = Templates->Class[ClassIndex];
+
+    ProtoMask = Class->PermProtos;
+    ConfigMask = Class->PermConfigs;
+    if (config_pruner_enabled && Class->NumPermConfigs > 1) {
+      PrunedConfigs = PruneAdaptedConfigs (Class, NumFeatures, IntFeatures);
+      if (PrunedConfigs != *ConfigMask) {
+        config_mask_to_proto_mask (ClassForIndex (Templates->Templates,
+          ClassIndex), &PrunedConfigs,
+          PrunedAdaptedProtos);
+        ProtoMask = PrunedAdaptedProtos;
+        ConfigMask = &PrunedConfigs;
+      }
+    }
 
     SetBaseLineMatch();
     IntegerMatcher (ClassForClassId (Templates->Templates, ClassId),
-      Templates->Class[ClassIndex]->PermProtos,
-      Templates->Class[ClassIndex]->PermConfigs,
+      ProtoMask, ConfigMask,
       IntOutlineLength, NumFeatures, IntFeatures, 0,
       CharNormArray[ClassIndex], &IntResult, MatchDebugFlags);
 
@@ -1668,107 +1798,67 @@ char *BaselineClassifier(TBLOB *Blob,
 
 
 /*---------------------------------------------------------------------------*/
-void make_config_pruner(INT_TEMPLATES templates,
-                        CONFIG_PRUNER *config_pruner) {
-  int classid;
-  int x;                         //feature coord
-  int word_index;                //in faster version
-  int bit_index;
-  UINT32 XFeatureAddress;
-  UINT32 YFeatureAddress;
-  UINT32 ThetaFeatureAddress;
-  INT_CLASS ClassTemplate;
-  int ProtoSetIndex;
-  PROTO_SET ProtoSet;
-  UINT32 *ProtoPrunerPtr;
-  UINT32 ProtoNum;
-  INT32 proto_offset;
-  UINT32 ConfigWord;
-  UINT32 ProtoWord;
-  INT_PROTO Proto;
-  UINT32 x_config_mask;          //forming mask
-  UINT32 y_config_mask;          //forming mask
-  UINT32 th_config_mask;         //forming mask
-
-  for (classid = 0; classid < NumClassesIn (templates); classid++) {
-    ClassTemplate = ClassForIndex (templates, classid);
-    for (x = 0; x < NUM_PP_BUCKETS; x++) {
-      XFeatureAddress = (x << 1);
-      YFeatureAddress = (NUM_PP_BUCKETS << 1) + (x << 1);
-      ThetaFeatureAddress = (NUM_PP_BUCKETS << 2) + (x << 1);
-      x_config_mask = 0;
-      y_config_mask = 0;
-      th_config_mask = 0;
-      for (ProtoSetIndex = 0;
-        ProtoSetIndex < NumProtoSetsIn (ClassTemplate);
-      ProtoSetIndex++) {
-        ProtoSet = ProtoSetIn (ClassTemplate, ProtoSetIndex);
-        ProtoPrunerPtr = (UINT32 *) ((*ProtoSet).ProtoPruner);
-        for (ProtoNum = 0; ProtoNum < PROTOS_PER_PROTO_SET;
-        ProtoNum += (PROTOS_PER_PROTO_SET >> 1), ProtoPrunerPtr++) {
-          /* Prune Protos of current Proto Set */
-          ProtoWord = *(ProtoPrunerPtr + XFeatureAddress);
-          for (proto_offset = 0; ProtoWord != 0;
-          proto_offset++, ProtoWord >>= 1) {
-            if (ProtoWord & 1) {
-              Proto =
-                &(ProtoSet->Protos[ProtoNum + proto_offset]);
-              ConfigWord = Proto->Configs[0];
-              x_config_mask |= ConfigWord;
-            }
-          }
-
-          ProtoWord = *(ProtoPrunerPtr + YFeatureAddress);
-          for (proto_offset = 0; ProtoWord != 0;
-          proto_offset++, ProtoWord >>= 1) {
-            if (ProtoWord & 1) {
-              Proto =
-                &(ProtoSet->Protos[ProtoNum + proto_offset]);
-              ConfigWord = Proto->Configs[0];
-              y_config_mask |= ConfigWord;
-            }
-          }
+UINT32 PruneAdaptedConfigs(ADAPT_CLASS Class,
+                           INT16 NumFeatures,
+                           INT_FEATURE_ARRAY Features) {
+/*
+ **							Parameters:
+ **							Class
+              adapted class whose configs are to be pruned
+**							NumFeatures
+              number of features in Features
+**							Features
+              baseline normalized features of the unknown
+**							Globals:
+**							ConfigPruneFraction
+              fraction of best config hits needed to survive
+**							Operation: This routine finds the permanent configs of Class
+**							that are worth matching against Features.  The configs
+**							with a proto near a feature are the AND of the config
+**							pruner words for the feature's x, y and direction
+**							buckets.  Configs are kept if they are hit by at least
+**							ConfigPruneFraction as many features as the best config.
+**							Return: Mask of permanent configs to match.
+**							Exceptions: none
+**							History: Sun Oct 18 15:40:12 2026, Created.
+*/
+  int Feature;
+  int ConfigId;
+  int BestHits;
+  int HitCount[MAX_NUM_CONFIGS];
+  UINT32 Hits;
+  UINT32 PermMask;
+  UINT32 Result;
+  FLOAT32 Threshold;
+
+  PermMask = Class->PermConfigs[0];
+  for (ConfigId = 0; ConfigId < MAX_NUM_CONFIGS; ConfigId++)
+    HitCount[ConfigId] = 0;
+
+  for (Feature = 0; Feature < NumFeatures; Feature++) {
+    Hits = Class->ConfigPruner[PRUNER_X][Features[Feature].X >> 2]
+      & Class->ConfigPruner[PRUNER_Y][Features[Feature].Y >> 2]
+      & Class->ConfigPruner[PRUNER_ANGLE][Features[Feature].Theta >> 2]
+      & PermMask;
+    for (ConfigId = 0; Hits != 0; ConfigId++, Hits >>= 1)
+      if (Hits & 1)
+        HitCount[ConfigId]++;
+  }
 
-          ProtoWord = *(ProtoPrunerPtr + ThetaFeatureAddress);
-          for (proto_offset = 0; ProtoWord != 0;
-          proto_offset++, ProtoWord >>= 1) {
-            if (ProtoWord & 1) {
-              Proto =
-                &(ProtoSet->Protos[ProtoNum + proto_offset]);
-              ConfigWord = Proto->Configs[0];
-              th_config_mask |= ConfigWord;
-            }
-          }
-        }
-      }
-      for (word_index = 0; word_index < 4; word_index++) {
-        ConfigWord = 0;
-        for (bit_index = 0; bit_index < 8; bit_index++) {
-          if (x_config_mask & 1)
-            ConfigWord |= 1 << (bit_index * 4);
-          x_config_mask >>= 1;
-        }
-        config_pruner[classid][0][x][word_index] = ConfigWord;
+  BestHits = 0;
+  for (ConfigId = 0; ConfigId < MAX_NUM_CONFIGS; ConfigId++)
+    if (HitCount[ConfigId] > BestHits)
+      BestHits = HitCount[ConfigId];
+  Threshold = BestHits * ConfigPruneFraction;
 
-        ConfigWord = 0;
-        for (bit_index = 0; bit_index < 8; bit_index++) {
-          if (y_config_mask & 1)
-            ConfigWord |= 1 << (bit_index * 4);
-          y_config_mask >>= 1;
-        }
-        config_pruner[classid][1][x][word_index] = ConfigWord;
+  Result = 0;
+  for (ConfigId = 0; ConfigId < MAX_NUM_CONFIGS; ConfigId++)
+    if ((PermMask & ((UINT32) 1 << ConfigId))
+      && HitCount[ConfigId] >= Threshold)
+      Result |= (UINT32) 1 << ConfigId;
+  return (Result);
 
-        ConfigWord = 0;
-        for (bit_index = 0; bit_index < 8; bit_index++) {
-          if (th_config_mask & 1)
-            ConfigWord |= 1 << (bit_index * 4);
-          th_config_mask >>= 1;
-        }
-        config_pruner[classid][2][x][word_index] = ConfigWord;
-      }
-    }
-  }
-}
+}                                /* PruneAdaptedConfigs */
 
 
 /*---------------------------------------------------------------------------*/
@@ -1811,6 +1901,11 @@ void CharNormClassifier(TBLOB *Blob,
   CLASS_NORMALIZATION_ARRAY CharNormArray;
   CLASS_PRUNER_RESULTS ClassPrunerResults;
   INT_RESULT_STRUCT IntResult;
+  INT_CLASS MatchClasses[MAX_NUM_CLASSES];
+  BIT_VECTOR MatchConfigs[MAX_NUM_CLASSES];
+  UINT8 MatchNorms[MAX_NUM_CLASSES];
+  INT_RESULT_STRUCT MatchResults[MAX_NUM_CLASSES];
+  BOOL8 Batched;
   CLASS_ID ClassId;
   CLASS_INDEX ClassIndex;
 
@@ -1854,6 +1949,23 @@ void CharNormClassifier(TBLOB *Blob,
   if (MatcherDebugLevel >= 2 || display_ratings > 1)
     cprintf ("CN Matches =  ");
 
+  /* when every class is matched, with the same protos and no debug,
+     match them all in one call to share the feature setup */
+  Batched = (newcp_ratings_on & 3) < 2 && feature_prune_percentile <= 0
+    && MatchDebugFlags == 0;
+  if (Batched) {
+    for (i = 0; i < NumClasses; i++) {
+      ClassId = ClassPrunerResults[i].Class;
+      MatchClasses[i] = ClassForClassId (Templates, ClassId);
+      MatchConfigs[i] = (BIT_VECTOR) & ClassPrunerResults[i].config_mask;
+      MatchNorms[i] = CharNormArray[IndexForClassId (Templates, ClassId)];
+    }
+    SetCharNormMatch();
+    IntegerMatchClasses(NumClasses, MatchClasses, PrunedProtos,
+                        MatchConfigs, MatchNorms, IntOutlineLength,
+                        NumFeatures, IntFeatures, 0, MatchResults);
+  }
+
   best_rating = WORST_POSSIBLE_RATING;
   for (i = 0; i < NumClasses
     && ((newcp_ratings_on & 3) < 2
@@ -1864,16 +1976,20 @@ void CharNormClassifier(TBLOB *Blob,
     ClassId = ClassPrunerResults[i].Class;
     ClassIndex = IndexForClassId (Templates, ClassId);
 
-    SetCharNormMatch();
+    if (Batched)
+      IntResult = MatchResults[i];
+    else {
+      SetCharNormMatch();
 
-    if (feature_prune_percentile > 0)
+      if (feature_prune_percentile > 0)
                                  //xiaofan
-      config_mask_to_proto_mask (ClassForClassId (Templates, ClassId), (BIT_VECTOR) & ClassPrunerResults[i].config_mask,
-        PrunedProtos);
+        config_mask_to_proto_mask (ClassForClassId (Templates, ClassId), (BIT_VECTOR) & ClassPrunerResults[i].config_mask,
+          PrunedProtos);
                                  //xiaofan
-    IntegerMatcher (ClassForClassId (Templates, ClassId), PrunedProtos, (BIT_VECTOR) & ClassPrunerResults[i].config_mask,
-      IntOutlineLength, NumFeatures, IntFeatures, 0,
-      CharNormArray[ClassIndex], &IntResult, MatchDebugFlags);
+      IntegerMatcher (ClassForClassId (Templates, ClassId), PrunedProtos, (BIT_VECTOR) & ClassPrunerResults[i].config_mask,
+        IntOutlineLength, NumFeatures, IntFeatures, 0,
+        CharNormArray[ClassIndex], &IntResult, MatchDebugFlags);
+    }
 
     if (MatcherDebugLevel >= 2 || display_ratings > 1) {
       cprintf ("%c-%-2d %2.1f(%2.1f/%2.1f)  ", ClassId, IntResult.Config,
@@ -2242,14 +2358,7 @@ void DoAdaptiveMatch(TBLOB *Blob,
 
     EnterClassifyMode;
 
-    Results.NumMatches = 0;
-    Results.BestRating = WORST_POSSIBLE_RATING;
-    Results.BestClass = NO_CLASS;
-    Results.BestConfig = 0;
-    InitMatcherRatings (Results.Ratings);
-
-    CharNormClassifier(Blob, LineStats, PreTrainedTemplates, &Results);
-    RemoveBadMatches(&Results);
+    GetPreTrainedMatches(Blob, LineStats, &Results);
 
     /* save ratings in a global so that CompareCurrentRatings() can see them */
     CurrentRatings = Results.Ratings;
@@ -2272,6 +2381,55 @@ void DoAdaptiveMatch(TBLOB *Blob,
 
   }                              /* GetAmbiguities */
 
+  /*---------------------------------------------------------------------------*/
+  void GetPreTrainedMatches(TBLOB *Blob,
+                            LINE_STATS *LineStats,
+                            ADAPT_RESULTS *Results) {
+  /*
+   **							Parameters:
+   **							Blob
+                blob to match against the built-in templates
+  **							LineStats
+                statistics for text line blob is in
+  **							Results
+                place to put match results
+  **							Globals:
+  **							PreTrainedTemplates
+                built-in templates
+  **							AdaptBlob
+                blob currently being adapted to
+  **							AdaptBlobMatched
+                TRUE if AdaptBlobResults are valid
+  **							AdaptBlobResults
+                pre-trained matches for AdaptBlob
+  **							Operation: This routine matches Blob to the built-in templates
+  **							and removes the bad matches.  If Blob is the blob currently
+  **							being adapted to, the match is only done the first time
+  **							and later calls get a copy of the saved results.
+  **							Return: none (results are returned in Results)
+  **							Exceptions: none
+  **							History: Sun Oct 18 10:41:17 2026, Created.
+  */
+    if (Blob == AdaptBlob && AdaptBlobMatched) {
+      *Results = AdaptBlobResults;
+      return;
+    }
+
+    Results->BlobLength = MAX_FLOAT32;
+    Results->NumMatches = 0;
+    Results->BestRating = WORST_POSSIBLE_RATING;
+    Results->BestClass = NO_CLASS;
+    Results->BestConfig = 0;
+    InitMatcherRatings (Results->Ratings);
+    CharNormClassifier(Blob, LineStats, PreTrainedTemplates, Results);
+    RemoveBadMatches(Results);
+
+    if (Blob == AdaptBlob) {
+      AdaptBlobResults = *Results;
+      AdaptBlobMatched = TRUE;
+    }
+  }                              /* GetPreTrainedMatches */
+
   /*---------------------------------------------------------------------------*/
   int GetBaselineFeatures(TBLOB *Blob,
                           LINE_STATS *LineStats,
@@ -2554,7 +2712,6 @@ void DoAdaptiveMatch(TBLOB *Blob,
   */
     register INT_FEATURE Src, Dest, End;
     FEATURE NormFeature;
-    FLOAT32 Baseline, Scale;
 
     if (!FeaturesHaveBeenExtracted) {
       FeaturesOK = ExtractIntFeat (Blob, BaselineFeatures,
@@ -2571,17 +2728,11 @@ void DoAdaptiveMatch(TBLOB *Blob,
       Src < End; *Dest++ = *Src++);
 
     NormFeature = NewFeature (&CharNormDesc);
-    Baseline = BaselineAt (LineStats, FXInfo.Xmean);
-    Scale = ComputeScaleFactor (LineStats);
-    ParamOf (NormFeature, CharNormY) = (FXInfo.Ymean - Baseline) * Scale;
-    ParamOf (NormFeature, CharNormLength) =
-      FXInfo.Length * Scale / LENGTH_COMPRESSION;
-    ParamOf (NormFeature, CharNormRx) = FXInfo.Rx * Scale;
-    ParamOf (NormFeature, CharNormRy) = FXInfo.Ry * Scale;
+    SetCharNormFeature(NormFeature, &FXInfo, LineStats);
     ComputeIntCharNormArray(NormFeature, Templates, CharNormArray);
     FreeFeature(NormFeature);
 
-    *BlobLength = FXInfo.Length * Scale;
+    *BlobLength = FXInfo.Length * ComputeScaleFactor (LineStats);
     return (FXInfo.NumCN);
 
   }                              /* GetIntCharNormFeatures */
@@ -2831,6 +2982,8 @@ void DoAdaptiveMatch(TBLOB *Blob,
     Config = TempConfigFor (Class, ConfigId);
 
     MakeConfigPermanent(Class, ConfigId);
+    AddConfigToConfigPruner (Class, ClassForIndex (Templates->Templates,
+      ClassIndex), ConfigId);
     if (Class->NumPermConfigs == 0)
       Templates->NumPermClasses++;
     Class->NumPermConfigs++;
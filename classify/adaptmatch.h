@@ -28,6 +28,8 @@
 #include "adaptive.h"
 #include "ocrfeatures.h"
 
+#define MAX_ADAPTABLE_WERD_SIZE 40
+
 /*---------------------------------------------------------------------------
           Variables
 ----------------------------------------------------------------------------*/
@@ -49,6 +51,18 @@ void AdaptToWord(TWERD *Word,
                  const char *BestRawChoice,
                  const char *rejmap);
 
+BOOL8 GetWordAdaptThresholds(TWERD *Word,
+                             TEXTROW *Row,
+                             const char *BestChoice,
+                             const char *BestRawChoice,
+                             FLOAT32 *Thresholds);
+
+void AdaptToWordWithThresholds(TWERD *Word,
+                               TEXTROW *Row,
+                               const char *BestChoice,
+                               const char *rejmap,
+                               FLOAT32 *Thresholds);
+
 void EndAdaptiveClassifier(); 
 
 void InitAdaptiveClassifier(); 
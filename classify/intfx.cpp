@@ -32,6 +32,7 @@ int SaveFeature();
 UINT8 TableLookup(); 
 UINT8 MySqrt2(); 
 void ClipRadius(); 
+INT16 RadiusFromInverse(UINT8 Inv, UINT8 Exp);
 
 make_int_var (RadiusGyrMinMan, 255, MakeRadiusGyrMinMan,
 16, 10, SetRadiusGyrMinMan,
@@ -218,8 +219,8 @@ int ExtractIntFeat(TBLOB *Blob,
   RyInv = MySqrt2 (NumBLFeatures, Iy, &RyExp);
   ClipRadius(&RxInv, &RxExp, &RyInv, &RyExp); 
 
-  Results->Rx = (INT16) (51.2 / (double) RxInv * pow (2.0, (double) RxExp));
-  Results->Ry = (INT16) (51.2 / (double) RyInv * pow (2.0, (double) RyExp));
+  Results->Rx = RadiusFromInverse (RxInv, RxExp);
+  Results->Ry = RadiusFromInverse (RyInv, RyExp);
   Results->NumBL = NumBLFeatures;
 
   /* extract character normalized features */
@@ -454,6 +455,32 @@ UINT8 MySqrt2(UINT16 N, UINT32 I, UINT8 *Exp) {
 }
 
 
+/*--------------------------------------------------------------------------*/
+INT16 RadiusFromInverse(UINT8 Inv, UINT8 Exp) {
+/*
+ **      Parameters:
+ **              Inv             mantissa of inverse radius  x.xxxxxxx
+ **              Exp             exponent of inverse radius
+ **      Operation:
+ **              Convert the inverse radius of gyration from MySqrt2 back to
+ **              a radius, 51.2 / Inv * 2^Exp, in integer arithmetic only so
+ **              that the result is the same on every platform.
+ **              51.2 = 256 / 5.  Radii too big for an INT16 are clipped.
+ **      Return: Radius of gyration.
+ **      Exceptions: none
+ **      History: Sun Oct 18 16:21:37 2026, Created.
+ */
+  UINT32 Radius;
+
+  if (Inv == 0 || Exp > 23)
+    return MAX_INT16;
+  Radius = ((UINT32) 256 << Exp) / (5 * (UINT32) Inv);
+  if (Radius > MAX_INT16)
+    return MAX_INT16;
+  return (INT16) Radius;
+}
+
+
 /*-------------------------------------------------------------------------*/
 void ClipRadius(UINT8 *RxInv, UINT8 *RxExp, UINT8 *RyInv, UINT8 *RyExp) { 
   register UINT8 AM, BM, AE, BE;
@@ -60,4 +60,6 @@ UINT16 MySqrt(INT32 X, INT32 Y);
 UINT8 MySqrt2(UINT16 N, UINT32 I, UINT8 *Exp); 
 
 void ClipRadius(UINT8 *RxInv, UINT8 *RxExp, UINT8 *RyInv, UINT8 *RyExp); 
+
+INT16 RadiusFromInverse(UINT8 Inv, UINT8 Exp);
 #endif
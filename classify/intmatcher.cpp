@@ -1027,6 +1027,7 @@ void IntegerMatcher(INT_CLASS ClassTemplate,
   static UINT8 FeatureEvidence[MAX_NUM_CONFIGS];
   static int SumOfFeatureEvidence[MAX_NUM_CONFIGS];
   static UINT8 ProtoEvidence[MAX_NUM_PROTOS][MAX_PROTO_INDEX];
+  IM_FEATURE_STRUCT Prepared;
   int Feature;
   int BestMatch;
   int used_features;
@@ -1036,13 +1037,26 @@ void IntegerMatcher(INT_CLASS ClassTemplate,
 
   IMClearTables(ClassTemplate, SumOfFeatureEvidence, ProtoEvidence);
 
-  for (Feature = 0, used_features = 0; Feature < NumFeatures; Feature++) {
-    if (Features[Feature].CP_misses >= min_misses) {
-      IMUpdateTablesForFeature (ClassTemplate, ProtoMask, ConfigMask,
-        Feature, &(Features[Feature]),
-        FeatureEvidence, SumOfFeatureEvidence,
-        ProtoEvidence, Debug);
-      used_features++;
+  if (Debug == 0) {
+    for (Feature = 0, used_features = 0; Feature < NumFeatures; Feature++) {
+      if (Features[Feature].CP_misses >= min_misses) {
+        IMPrepareFeature (&(Features[Feature]), &Prepared);
+        IMUpdateTablesNoDebug (ClassTemplate, ProtoMask, ConfigMask,
+          &Prepared, FeatureEvidence, SumOfFeatureEvidence,
+          ProtoEvidence);
+        used_features++;
+      }
+    }
+  }
+  else {
+    for (Feature = 0, used_features = 0; Feature < NumFeatures; Feature++) {
+      if (Features[Feature].CP_misses >= min_misses) {
+        IMUpdateTablesForFeature (ClassTemplate, ProtoMask, ConfigMask,
+          Feature, &(Features[Feature]),
+          FeatureEvidence, SumOfFeatureEvidence,
+          ProtoEvidence, Debug);
+        used_features++;
+      }
     }
   }
 
@@ -1101,6 +1115,81 @@ void IntegerMatcher(INT_CLASS ClassTemplate,
 }
 
 
+/*---------------------------------------------------------------------------*/
+void IntegerMatchClasses(int NumClasses,
+                         INT_CLASS *ClassTemplates,
+                         BIT_VECTOR ProtoMask,
+                         BIT_VECTOR *ConfigMasks,
+                         UINT8 *NormalizationFactors,
+                         UINT16 BlobLength,
+                         INT16 NumFeatures,
+                         INT_FEATURE_ARRAY Features,
+                         INT32 min_misses,
+                         INT_RESULT_STRUCT *Results) {
+/*
+ **      Parameters:
+ **              NumClasses                Number of classes to match
+ **              ClassTemplates            Prototypes & tables per class
+ **              ProtoMask                 Protos to use in every class
+ **              ConfigMasks               Configs to use per class
+ **              NormalizationFactors      Fudge factor per class
+ **              BlobLength                Length of unormalized blob
+ **              NumFeatures               Number of features in blob
+ **              Features                  Array of features
+ **              Results                   Rating & configuration per
+ **                                        class: (0.0 -> 1.0), 0=good
+ **      Globals:
+ **      Operation:
+ **              IntegerMatchClasses gives the same results as calling
+ **              IntegerMatcher without debug for each class in turn, but
+ **              the proto pruner addresses and centred position of each
+ **              feature are worked out once for all the classes.
+ **      Return:
+ **      Exceptions: none
+ **      History: Sun Oct 18 13:02:44 2026, Created.
+ */
+  static UINT8 FeatureEvidence[MAX_NUM_CONFIGS];
+  static int SumOfFeatureEvidence[MAX_NUM_CONFIGS];
+  static UINT8 ProtoEvidence[MAX_NUM_PROTOS][MAX_PROTO_INDEX];
+  static IM_FEATURE_STRUCT Prepared[MAX_NUM_INT_FEATURES];
+  int Feature;
+  int used_features;
+  int ClassIndex;
+
+  for (Feature = 0, used_features = 0; Feature < NumFeatures; Feature++) {
+    if (Features[Feature].CP_misses >= min_misses)
+      IMPrepareFeature (&(Features[Feature]), &(Prepared[used_features++]));
+  }
+
+  for (ClassIndex = 0; ClassIndex < NumClasses; ClassIndex++) {
+    IMClearTables (ClassTemplates[ClassIndex], SumOfFeatureEvidence,
+      ProtoEvidence);
+
+    for (Feature = 0; Feature < used_features; Feature++)
+      IMUpdateTablesNoDebug (ClassTemplates[ClassIndex],
+        ProtoMask, ConfigMasks[ClassIndex],
+        &(Prepared[Feature]),
+        FeatureEvidence, SumOfFeatureEvidence,
+        ProtoEvidence);
+
+    IMUpdateSumOfProtoEvidences (ClassTemplates[ClassIndex],
+      ConfigMasks[ClassIndex],
+      SumOfFeatureEvidence,
+      ProtoEvidence, NumFeatures);
+
+    IMNormalizeSumOfEvidences (ClassTemplates[ClassIndex],
+      SumOfFeatureEvidence,
+      NumFeatures, used_features);
+
+    IMFindBestMatch (ClassTemplates[ClassIndex],
+      SumOfFeatureEvidence,
+      BlobLength,
+      NormalizationFactors[ClassIndex],
+      &(Results[ClassIndex]));
+  }
+}
+
+
 /*---------------------------------------------------------------------------*/
 int FindGoodProtos(INT_CLASS ClassTemplate,
                    BIT_VECTOR ProtoMask,
@@ -1674,6 +1763,74 @@ int Debug) {
  **      Return:
  **      Exceptions: none
  **      History: Wed Feb 27 14:12:28 MST 1991, RWM, Created.
+ */
+  IM_FEATURE_STRUCT Prepared;
+
+  IMPrepareFeature(Feature, &Prepared);
+  IMUpdateTablesForPreparedFeature(ClassTemplate, ProtoMask, ConfigMask,
+                                   FeatureNum, &Prepared,
+                                   FeatureEvidence, SumOfFeatureEvidence,
+                                   ProtoEvidence, Debug);
+}
+
+
+/*---------------------------------------------------------------------------*/
+void IMPrepareFeature(INT_FEATURE Feature, IM_FEATURE Prepared) {
+/*
+ **      Parameters:
+ **              Feature               Pointer to a feature struct
+ **              Prepared              Place to put derived values
+ **      Globals:
+ **      Operation:
+ **              Work out the class independent values needed to match
+ **              Feature: the offsets of its buckets in a proto pruner
+ **              and its position relative to the centre.
+ **      Return:
+ **      Exceptions: none
+ **      History: Sun Oct 18 13:02:44 2026, Created.
+ */
+  Prepared->XAddress = ((Feature->X >> 2) << 1);
+  Prepared->YAddress = (NUM_PP_BUCKETS << 1) + ((Feature->Y >> 2) << 1);
+  Prepared->ThetaAddress = (NUM_PP_BUCKETS << 2) + ((Feature->Theta >> 2) << 1);
+  Prepared->X = Feature->X - 128;
+  Prepared->Y = Feature->Y - 128;
+  Prepared->Theta = Feature->Theta;
+}
+
+
+/*---------------------------------------------------------------------------*/
+template <BOOL8 DebugOn> static void
+IMUpdateTablesKernel (INT_CLASS ClassTemplate,
+BIT_VECTOR ProtoMask,
+BIT_VECTOR ConfigMask,
+int FeatureNum,
+IM_FEATURE Feature,
+UINT8 FeatureEvidence[MAX_NUM_CONFIGS],
+int SumOfFeatureEvidence[MAX_NUM_CONFIGS],
+UINT8
+ProtoEvidence[MAX_NUM_PROTOS][MAX_PROTO_INDEX],
+int Debug) {
+/*
+ **      Parameters:
+ **              ClassTemplate         Prototypes & tables for a class
+ **              FeatureNum            Current feature number (for DEBUG only)
+ **              Feature               Feature from IMPrepareFeature
+ **              FeatureEvidence       Feature Evidence Table
+ **              SumOfFeatureEvidence  Sum of Feature Evidence Table
+ **              ProtoEvidence         Prototype Evidence Table
+ **              Debug                 Debugger flag: 1=debugger on
+ **              DebugOn               FALSE to leave out debug tests
+ **      Globals:
+ **      Operation:
+ **              For the given feature: prune protos, compute evidence, update Feature Evidence,
+ **              Proto Evidence, and Sum of Feature Evidence tables.
+ **              This is the body of IMUpdateTablesForPreparedFeature and
+ **              IMUpdateTablesNoDebug.  The copy made for DebugOn FALSE
+ **              has no debug tests in its proto loop.
+ **      Return:
+ **      Exceptions: none
+ **      History: Wed Feb 27 14:12:28 MST 1991, RWM, Created.
+ **               Sun Oct 18 13:02:44 2026, takes a prepared feature.
  */
   register UINT32 ConfigWord;
   register UINT32 ProtoWord;
@@ -1689,9 +1846,6 @@ int Debug) {
   INT_PROTO Proto;
   int ProtoSetIndex;
   UINT8 Evidence;
-  UINT32 XFeatureAddress;
-  UINT32 YFeatureAddress;
-  UINT32 ThetaFeatureAddress;
   register UINT8 *UINT8Pointer;
   register int ProtoIndex;
   UINT8 Temp;
@@ -1704,11 +1858,6 @@ int Debug) {
   IMClearFeatureEvidenceTable (FeatureEvidence,
     NumIntConfigsIn (ClassTemplate));
 
-  /* Precompute Feature Address offset for Proto Pruning */
-  XFeatureAddress = ((Feature->X >> 2) << 1);
-  YFeatureAddress = (NUM_PP_BUCKETS << 1) + ((Feature->Y >> 2) << 1);
-  ThetaFeatureAddress = (NUM_PP_BUCKETS << 2) + ((Feature->Theta >> 2) << 1);
-
   for (ProtoSetIndex = 0, ActualProtoNum = 0;
   ProtoSetIndex < NumProtoSetsIn (ClassTemplate); ProtoSetIndex++) {
     ProtoSet = ProtoSetIn (ClassTemplate, ProtoSetIndex);
@@ -1717,9 +1866,9 @@ int Debug) {
       ProtoNum += (PROTOS_PER_PROTO_SET >> 1), ActualProtoNum +=
     (PROTOS_PER_PROTO_SET >> 1), ProtoMask++, ProtoPrunerPtr++) {
       /* Prune Protos of current Proto Set */
-      ProtoWord = *(ProtoPrunerPtr + XFeatureAddress);
-      ProtoWord &= *(ProtoPrunerPtr + YFeatureAddress);
-      ProtoWord &= *(ProtoPrunerPtr + ThetaFeatureAddress);
+      ProtoWord = *(ProtoPrunerPtr + Feature->XAddress);
+      ProtoWord &= *(ProtoPrunerPtr + Feature->YAddress);
+      ProtoWord &= *(ProtoPrunerPtr + Feature->ThetaAddress);
       ProtoWord &= *ProtoMask;
 
       if (ProtoWord != 0) {
@@ -1736,8 +1885,8 @@ int Debug) {
           proto_byte = next_table[proto_byte];
           Proto = &(ProtoSet->Protos[ProtoNum + proto_offset]);
           ConfigWord = Proto->Configs[0];
-          A3 = (((Proto->A * (Feature->X - 128)) << 1)
-            - (Proto->B * (Feature->Y - 128)) + (Proto->C << 9));
+          A3 = (((Proto->A * Feature->X) << 1)
+            - (Proto->B * Feature->Y) + (Proto->C << 9));
           M3 =
             (((INT8) (Feature->Theta - Proto->Angle)) *
             IntThetaFudge) << 1;
@@ -1760,7 +1909,7 @@ int Debug) {
           else
             Evidence = SimilarityEvidenceTable[A4];
 
-          if (PrintFeatureMatchesOn (Debug))
+          if (DebugOn && PrintFeatureMatchesOn (Debug))
             IMDebugConfiguration (FeatureNum,
               ActualProtoNum + proto_offset,
               Evidence, ConfigMask, ConfigWord);
@@ -1801,7 +1950,7 @@ int Debug) {
     }
   }
 
-  if (PrintFeatureMatchesOn (Debug))
+  if (DebugOn && PrintFeatureMatchesOn (Debug))
     IMDebugConfigurationSum (FeatureNum, FeatureEvidence,
       NumIntConfigsIn (ClassTemplate));
   IntPointer = SumOfFeatureEvidence;
@@ -1813,6 +1962,74 @@ int Debug) {
 }
 
 
+/*---------------------------------------------------------------------------*/
+void
+IMUpdateTablesForPreparedFeature (INT_CLASS ClassTemplate,
+BIT_VECTOR ProtoMask,
+BIT_VECTOR ConfigMask,
+int FeatureNum,
+IM_FEATURE Feature,
+UINT8 FeatureEvidence[MAX_NUM_CONFIGS],
+int SumOfFeatureEvidence[MAX_NUM_CONFIGS],
+UINT8
+ProtoEvidence[MAX_NUM_PROTOS][MAX_PROTO_INDEX],
+int Debug) {
+/*
+ **      Parameters:
+ **              ClassTemplate         Prototypes & tables for a class
+ **              FeatureNum            Current feature number (for DEBUG only)
+ **              Feature               Feature from IMPrepareFeature
+ **              FeatureEvidence       Feature Evidence Table
+ **              SumOfFeatureEvidence  Sum of Feature Evidence Table
+ **              ProtoEvidence         Prototype Evidence Table
+ **              Debug                 Debugger flag: 1=debugger on
+ **      Globals:
+ **      Operation:
+ **              For the given feature: prune protos, compute evidence, update Feature Evidence,
+ **              Proto Evidence, and Sum of Feature Evidence tables.
+ **      Return:
+ **      Exceptions: none
+ **      History: Wed Feb 27 14:12:28 MST 1991, RWM, Created.
+ **               Sun Oct 18 13:02:44 2026, takes a prepared feature.
+ */
+  IMUpdateTablesKernel<TRUE>(ClassTemplate, ProtoMask, ConfigMask,
+                             FeatureNum, Feature, FeatureEvidence,
+                             SumOfFeatureEvidence, ProtoEvidence, Debug);
+}
+
+
+/*---------------------------------------------------------------------------*/
+void
+IMUpdateTablesNoDebug (INT_CLASS ClassTemplate,
+BIT_VECTOR ProtoMask,
+BIT_VECTOR ConfigMask,
+IM_FEATURE Feature,
+UINT8 FeatureEvidence[MAX_NUM_CONFIGS],
+int SumOfFeatureEvidence[MAX_NUM_CONFIGS],
+UINT8
+ProtoEvidence[MAX_NUM_PROTOS][MAX_PROTO_INDEX]) {
+/*
+ **      Parameters:
+ **              ClassTemplate         Prototypes & tables for a class
+ **              Feature               Feature from IMPrepareFeature
+ **              FeatureEvidence       Feature Evidence Table
+ **              SumOfFeatureEvidence  Sum of Feature Evidence Table
+ **              ProtoEvidence         Prototype Evidence Table
+ **      Globals:
+ **      Operation:
+ **              Same as IMUpdateTablesForPreparedFeature with Debug 0,
+ **              but compiled without the debug tests in the proto loop.
+ **              Used by the matchers whenever debugging is off.
+ **      Return:
+ **      Exceptions: none
+ **      History: Sun Oct 18 17:40:12 2026, Created.
+ */
+  IMUpdateTablesKernel<FALSE>(ClassTemplate, ProtoMask, ConfigMask,
+                              0, Feature, FeatureEvidence,
+                              SumOfFeatureEvidence, ProtoEvidence, 0);
+}
+
+
 /*---------------------------------------------------------------------------*/
 #ifndef GRAPHICS_DISABLED
 void
@@ -51,6 +51,20 @@ typedef CP_RESULT_STRUCT CLASS_PRUNER_RESULTS[MAX_NUM_CLASSES];
 
 typedef UINT8 CLASS_NORMALIZATION_ARRAY[MAX_NUM_CLASSES];
 
+/* a feature with the values the integer matcher derives from it
+   before looking at any class: its proto pruner addresses and its
+   position relative to the centre of the feature space */
+typedef struct
+{
+  UINT32 XAddress;
+  UINT32 YAddress;
+  UINT32 ThetaAddress;
+  INT32 X;
+  INT32 Y;
+  UINT8 Theta;
+}
+IM_FEATURE_STRUCT, *IM_FEATURE;
+
 /*----------------------------------------------------------------------------
             Variables
 -----------------------------------------------------------------------------*/
@@ -108,6 +122,17 @@ void IntegerMatcher(INT_CLASS ClassTemplate,
                     INT_RESULT Result,
                     int Debug);
 
+void IntegerMatchClasses(int NumClasses,
+                         INT_CLASS *ClassTemplates,
+                         BIT_VECTOR ProtoMask,
+                         BIT_VECTOR *ConfigMasks,
+                         UINT8 *NormalizationFactors,
+                         UINT16 BlobLength,
+                         INT16 NumFeatures,
+                         INT_FEATURE_ARRAY Features,
+                         INT32 min_misses,
+                         INT_RESULT_STRUCT *Results);
+
 int FindGoodProtos(INT_CLASS ClassTemplate,
                    BIT_VECTOR ProtoMask,
                    BIT_VECTOR ConfigMask,
@@ -178,6 +203,28 @@ UINT8
 ProtoEvidence[MAX_NUM_PROTOS][MAX_PROTO_INDEX],
 int Debug);
 
+void IMPrepareFeature(INT_FEATURE Feature, IM_FEATURE Prepared);
+
+void IMUpdateTablesForPreparedFeature (INT_CLASS ClassTemplate,
+BIT_VECTOR ProtoMask,
+BIT_VECTOR ConfigMask,
+int FeatureNum,
+IM_FEATURE Feature,
+UINT8 FeatureEvidence[MAX_NUM_CONFIGS],
+int SumOfFeatureEvidence[MAX_NUM_CONFIGS],
+UINT8
+ProtoEvidence[MAX_NUM_PROTOS][MAX_PROTO_INDEX],
+int Debug);
+
+void IMUpdateTablesNoDebug (INT_CLASS ClassTemplate,
+BIT_VECTOR ProtoMask,
+BIT_VECTOR ConfigMask,
+IM_FEATURE Feature,
+UINT8 FeatureEvidence[MAX_NUM_CONFIGS],
+int SumOfFeatureEvidence[MAX_NUM_CONFIGS],
+UINT8
+ProtoEvidence[MAX_NUM_PROTOS][MAX_PROTO_INDEX]);
+
 #ifndef GRAPHICS_DISABLED
 void IMDebugFeatureProtoError (INT_CLASS ClassTemplate,
 BIT_VECTOR ProtoMask,
@@ -88,7 +88,8 @@ typedef struct
 
 PROTO_SET_STRUCT, *PROTO_SET;
 
-typedef UINT32 CONFIG_PRUNER[NUM_PP_PARAMS][NUM_PP_BUCKETS][4];
+/* one word of config bits per proto pruner bucket */
+typedef UINT32 CONFIG_PRUNER[NUM_PP_PARAMS][NUM_PP_BUCKETS];
 
 typedef struct
 {
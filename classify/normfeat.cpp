@@ -72,9 +72,6 @@ FEATURE_SET ExtractCharNormFeatures(TBLOB *Blob, LINE_STATS *LineStats) {
  */
   FEATURE_SET FeatureSet;
   FEATURE Feature;
-  FLOAT32 Scale;
-  FLOAT32 Baseline;
-  LIST Outlines;
   INT_FEATURE_ARRAY blfeatures;
   INT_FEATURE_ARRAY cnfeatures;
   INT_FX_RESULT_STRUCT FXInfo;
@@ -85,32 +82,10 @@ FEATURE_SET ExtractCharNormFeatures(TBLOB *Blob, LINE_STATS *LineStats) {
   Feature = NewFeature (&CharNormDesc);
   AddFeature(FeatureSet, Feature); 
 
-  /* compute the normalization statistics for this blob */
-  Outlines = ConvertBlob (Blob);
-  /*---------Debug--------------------------------------------------*
-  OFile = fopen ("f:/ims/debug/nfOutline.logCPP", "r");
-  if (OFile == NULL)
-  {
-    OFile = Efopen ("f:/ims/debug/nfOutline.logCPP", "w");
-    WriteOutlines(OFile, Outlines);
-  }
-  else
-  {
-    fclose (OFile);
-    OFile = Efopen ("f:/ims/debug/nfOutline.logCPP", "a");
-  }
-  WriteOutlines(OFile, Outlines);
-  fclose (OFile);
-  *--------------------------------------------------------------------*/
-
+  /* the normalization statistics come from the integer feature
+     extractor, so the blob is not converted to float outlines */
   ExtractIntFeat(Blob, blfeatures, cnfeatures, &FXInfo);
-  Baseline = BaselineAt (LineStats, FXInfo.Xmean);
-  Scale = ComputeScaleFactor (LineStats);
-  ParamOf (Feature, CharNormY) = (FXInfo.Ymean - Baseline) * Scale;
-  ParamOf (Feature, CharNormLength) =
-    FXInfo.Length * Scale / LENGTH_COMPRESSION;
-  ParamOf (Feature, CharNormRx) = FXInfo.Rx * Scale;
-  ParamOf (Feature, CharNormRy) = FXInfo.Ry * Scale;
+  SetCharNormFeature(Feature, &FXInfo, LineStats);
 
   /*---------Debug--------------------------------------------------*
   File = fopen ("f:/ims/debug/nfFeatSet.logCPP", "r");
@@ -127,6 +102,37 @@ FEATURE_SET ExtractCharNormFeatures(TBLOB *Blob, LINE_STATS *LineStats) {
   WriteFeatureSet(File, FeatureSet);
   fclose (File);
   *--------------------------------------------------------------------*/
-  FreeOutlines(Outlines); 
   return (FeatureSet);
 }                                /* ExtractCharNormFeatures */
+
+
+/*---------------------------------------------------------------------------*/
+void SetCharNormFeature(FEATURE Feature,
+                        INT_FX_RESULT FXInfo,
+                        LINE_STATS *LineStats) {
+/*
+ **	Parameters:
+ **		Feature		char norm feature to fill in
+ **		FXInfo		results of integer feature extraction
+ **		LineStats	statistics on text row blob is in
+ **	Globals: none
+ **	Operation: Set the parameters of a character normalization
+ **		feature from the length, center of mass and radii of
+ **		gyration that ExtractIntFeat has already found for the
+ **		blob in fixed point.  Only the final scaling to baseline
+ **		coordinates is done in floating point.
+ **	Return: none
+ **	Exceptions: none
+ **	History: Sun Oct 18 16:21:37 2026, Created.
+ */
+  FLOAT32 Scale;
+  FLOAT32 Baseline;
+
+  Baseline = BaselineAt (LineStats, FXInfo->Xmean);
+  Scale = ComputeScaleFactor (LineStats);
+  ParamOf (Feature, CharNormY) = (FXInfo->Ymean - Baseline) * Scale;
+  ParamOf (Feature, CharNormLength) =
+    FXInfo->Length * Scale / LENGTH_COMPRESSION;
+  ParamOf (Feature, CharNormRx) = FXInfo->Rx * Scale;
+  ParamOf (Feature, CharNormRy) = FXInfo->Ry * Scale;
+}                                /* SetCharNormFeature */
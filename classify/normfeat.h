@@ -24,6 +24,7 @@
 #include "ocrfeatures.h"
 #include "tessclas.h"
 #include "fxdefs.h"
+#include "intfx.h"
 
 #define LENGTH_COMPRESSION  (10.0)
 
@@ -38,6 +39,10 @@ FLOAT32 ActualOutlineLength(FEATURE Feature);
 
 FEATURE_SET ExtractCharNormFeatures(TBLOB *Blob, LINE_STATS *LineStats); 
 
+void SetCharNormFeature(FEATURE Feature,
+                        INT_FX_RESULT FXInfo,
+                        LINE_STATS *LineStats);
+
 /*
 #if defined(__STDC__) || defined(__cplusplus)
 # define        _ARGS(s) s
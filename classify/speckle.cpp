@@ -21,6 +21,7 @@
 #include "speckle.h"
 #include "debug.h"
 #include "blobs.h"
+#include <math.h>
 
 /**----------------------------------------------------------------------------
         Global Data Definitions and Declarations
@@ -39,6 +40,27 @@ make_float_var (SmallSpeckleCertainty, -1.0, MakeSmallSpeckleCertainty,
 16, 5, SetSmallSpeckleCertainty,
 "Small Speckle Certainty ...");
 
+/* define control knobs for rejecting noise before it is classified */
+make_toggle_var (EnableNoiseReject, 0, MakeEnableNoiseReject,
+16, 6, SetEnableNoiseReject, "Reject Noise Before Matching ...");
+
+make_float_var (MaxNoiseSize, 0.10, MakeMaxNoiseSize,
+16, 7, SetMaxNoiseSize, "Max Noise Size ...");
+
+make_float_var (MaxNoiseCompactness, 60.0, MakeMaxNoiseCompactness,
+16, 8, SetMaxNoiseCompactness, "Max Noise Perimeter^2/Area ...");
+
+make_int_var (MaxNoiseOutlines, 4, MakeMaxNoiseOutlines,
+16, 9, SetMaxNoiseOutlines, "Max Noise Outlines ...");
+
+/**----------------------------------------------------------------------------
+          Private Function Prototypes
+----------------------------------------------------------------------------**/
+void MeasureOutlines(TESSLINE *Outline,
+                     int *NumOutlines,
+                     FLOAT32 *Perimeter,
+                     FLOAT32 *Area);
+
 /**----------------------------------------------------------------------------
               Public Code
 ----------------------------------------------------------------------------**/
@@ -93,6 +115,10 @@ void InitSpeckleVars() {
   MakeSmallSpecklePenalty(); 
   MakeLargeSpecklePenalty(); 
   MakeSmallSpeckleCertainty(); 
+  MakeEnableNoiseReject(); 
+  MakeMaxNoiseSize(); 
+  MakeMaxNoiseCompactness(); 
+  MakeMaxNoiseOutlines(); 
 }                                /* InitSpeckleVars */
 
 
@@ -124,3 +150,119 @@ BOOL8 LargeSpeckle(TBLOB *Blob, TEXTROW *Row) {
     return (FALSE);
 
 }                                /* LargeSpeckle */
+
+
+/*---------------------------------------------------------------------------*/
+BOOL8 NoiseBlob(TBLOB *Blob, TEXTROW *Row) {
+/*
+ **	Parameters:
+ **		Blob		blob to test against noise criteria
+ **		Row		text row that blob is in
+ **	Globals:
+ **		EnableNoiseReject	TRUE if noise test is enabled
+ **		MaxLargeSpeckleSize	largest allowed speckle
+ **		MaxNoiseSize		blobs smaller than this are noise
+ **		MaxNoiseCompactness	max perimeter^2/area for non-noise
+ **		MaxNoiseOutlines	max outlines in a non-noise speckle
+ **	Operation: This routine decides whether Blob is so plainly noise
+ **		that it need not be passed to the matcher at all.  Only
+ **		blobs which LargeSpeckle would flag anyway are considered.
+ **		Of those, a blob is noise if it is tiny compared to the
+ **		row, if it is made of many small outlines, if its outline
+ **		is long and thin or ragged for the area it encloses, or
+ **		(in baseline normalized space) if it lies wholly outside
+ **		the band between the descender and ascender lines.  The
+ **		limits are loose so that periods, commas, dots and other
+ **		small punctuation still reach the classifier.
+ **	Return: TRUE if Blob is noise, FALSE otherwise.
+ **	Exceptions: none
+ **	History: Sun Oct 18 09:12:40 2026, Created.
+ */
+  FLOAT32 RowSize;
+  FLOAT32 Width;
+  FLOAT32 Height;
+  FLOAT32 Perimeter;
+  FLOAT32 Area;
+  int NumOutlines;
+  TPOINT TopLeft;
+  TPOINT BottomRight;
+
+  if (!EnableNoiseReject || Blob->outlines == NULL)
+    return (FALSE);
+
+  RowSize = RowHeight (Row);
+  blob_bounding_box(Blob, &TopLeft, &BottomRight); 
+  Width = BottomRight.x - TopLeft.x;
+  Height = TopLeft.y - BottomRight.y;
+
+  if (Width >= RowSize * MaxLargeSpeckleSize ||
+    Height >= RowSize * MaxLargeSpeckleSize)
+    return (FALSE);
+
+  if (Width < RowSize * MaxNoiseSize && Height < RowSize * MaxNoiseSize)
+    return (TRUE);
+
+  /* in baseline normalized space the x-height is BASELINE_SCALE, so
+     anything wholly below the descenders or above the ascenders is noise */
+  if (is_baseline_normalized () &&
+    (TopLeft.y < BASELINE_OFFSET - BASELINE_SCALE * 0.5 ||
+    BottomRight.y > BASELINE_OFFSET + BASELINE_SCALE * 1.75))
+    return (TRUE);
+
+  NumOutlines = 0;
+  Perimeter = 0.0;
+  Area = 0.0;
+  MeasureOutlines (Blob->outlines, &NumOutlines, &Perimeter, &Area);
+  Area = fabs (Area);
+
+  if (NumOutlines > MaxNoiseOutlines)
+    return (TRUE);
+  if (Area <= 0.0 || Perimeter * Perimeter > MaxNoiseCompactness * Area)
+    return (TRUE);
+
+  return (FALSE);
+
+}                                /* NoiseBlob */
+
+
+/**----------------------------------------------------------------------------
+              Private Code
+----------------------------------------------------------------------------**/
+/*---------------------------------------------------------------------------*/
+void MeasureOutlines(TESSLINE *Outline,
+                     int *NumOutlines,
+                     FLOAT32 *Perimeter,
+                     FLOAT32 *Area) {
+/*
+ **	Parameters:
+ **		Outline		first outline in list to measure
+ **		NumOutlines	incremented by number of outlines found
+ **		Perimeter	incremented by total outline length
+ **		Area		incremented by signed area enclosed
+ **	Globals: none
+ **	Operation: This routine walks the edge loops of Outline, its
+ **		siblings and all of their children.  Holes run the other
+ **		way round, so their area cancels out of the total.
+ **	Return: none
+ **	Exceptions: none
+ **	History: Sun Oct 18 09:12:40 2026, Created.
+ */
+  EDGEPT *Start;
+  EDGEPT *Point;
+
+  for (; Outline != NULL; Outline = Outline->next) {
+    (*NumOutlines)++;
+    Start = Outline->loop;
+    if (Start != NULL) {
+      Point = Start;
+      do {
+        *Perimeter += abs (Point->vec.x) + abs (Point->vec.y);
+        *Area += ((FLOAT32) Point->pos.x * Point->vec.y -
+          (FLOAT32) Point->pos.y * Point->vec.x) / 2.0;
+        Point = Point->next;
+      }
+      while (Point != Start);
+    }
+    MeasureOutlines (Outline->child, NumOutlines, Perimeter, Area);
+  }
+}                                /* MeasureOutlines */
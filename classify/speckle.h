@@ -41,6 +41,8 @@ void InitSpeckleVars();
 
 BOOL8 LargeSpeckle(TBLOB *Blob, TEXTROW *Row); 
 
+BOOL8 NoiseBlob(TBLOB *Blob, TEXTROW *Row);
+
 /*
 #if defined(__STDC__) || defined(__cplusplus)
 # define        _ARGS(s) s
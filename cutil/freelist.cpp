@@ -10,6 +10,7 @@
  ** limitations under the License.
 **************************************************************************/
 #include "freelist.h"
+#include "structures.h"
 #include "danerror.h"
 #include "callcpp.h"
 
@@ -78,8 +79,9 @@ void memfree(void *element) {
 /**********************************************************************
  * mem_tidy
  *
- * Do nothing.
+ * Check the memory and report the list cells in use.
  **********************************************************************/
 void mem_tidy(int level) {
   c_check_mem ("Old tidy", level);
+  cprintf ("%d list cells in use\n", cells_in_use ());
 }
@@ -47,6 +47,14 @@ int structblockcount = 0;
 void_void memory_print_functions[NUM_DATA_TYPES];
 int max_data_types = 0;
 
+static LIST free_cells = NIL;    /*cells ready for reuse */
+static int cells_used = 0;       /*cells handed out */
+
+#ifdef _DEBUG
+                                 /*node of a free cell */
+#define FREE_CELL_MARK  ((LIST) &free_cells)
+#endif
+
 /*----------------------------------------------------------------------
               F u n c t i o n s
 ----------------------------------------------------------------------*/
@@ -55,8 +63,65 @@ freeword, WERDBLOCK, "TWERD", wordcount)
 makestructure (newoutline, oldoutline, printol, TESSLINE,
 freeoutline, OUTLINEBLOCK, "TESSLINE", outlinecount);
 
-makestructure (new_cell, free_cell, printcell, _LIST_,
-freelist, LISTBLOCK, "LIST", listcount);
+/**********************************************************************
+ * new_cell
+ *
+ * Get a list cell from the free list. When it is empty, a block of
+ * LISTBLOCK cells is allocated in one piece and threaded onto it, so
+ * that the cells of a list are close together and the allocator is
+ * called once per block rather than once per cell. Blocks are kept for
+ * the life of the process; their cells are reused through the free list.
+ **********************************************************************/
+LIST new_cell() {
+  LIST cell;
+  LIST block;
+  int i;
+
+  if (free_cells == NIL) {
+    block = new _LIST_[LISTBLOCK];
+    structblockcount++;
+    for (i = LISTBLOCK - 1; i >= 0; i--) {
+      block[i].next = free_cells;
+      free_cells = &block[i];
+    }
+  }
+  cell = free_cells;
+  free_cells = cell->next;
+  cell->node = NIL;
+  cell->next = NIL;
+  cells_used++;
+  return cell;
+}
+
+
+/**********************************************************************
+ * free_cell
+ *
+ * Return a list cell to the free list. In debug builds freed cells
+ * are marked so that a cell freed twice is caught here.
+ **********************************************************************/
+void free_cell(LIST cell) {
+#ifdef _DEBUG
+  if (cell->node == FREE_CELL_MARK) {
+    cprintf ("free_cell: cell freed twice\n");
+    return;
+  }
+  cell->node = FREE_CELL_MARK;
+#endif
+  cell->next = free_cells;
+  free_cells = cell;
+  cells_used--;
+}
+
+
+/**********************************************************************
+ * cells_in_use
+ *
+ * Number of list cells currently handed out by new_cell.
+ **********************************************************************/
+int cells_in_use() {
+  return cells_used;
+}
 
 newstructure (newblob, TBLOB, freeblob, BLOBBLOCK, "newblob", blobcount);
 oldstructure (oldblob, TBLOB, freeblob, "BLOB", blobcount);
@@ -109,4 +109,5 @@ extern void oldword(TWERD *);
 
 extern LIST new_cell();
 extern void free_cell(LIST);
+extern int cells_in_use();
 #endif
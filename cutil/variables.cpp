@@ -33,11 +33,15 @@
 #include "listio.h"
 #include "globals.h"
 #include "scanutils.h"
+#include "hashfn.h"
 
 /*----------------------------------------------------------------------
           V a r i a b l e s
 ----------------------------------------------------------------------*/
 static LIST variable_list = NIL;
+static VARIABLE **variable_index = NULL;
+static int variable_index_bits = 0;
+static int variable_index_valid = FALSE;
 //extern char                                   *demodir;
 
 VALUE dummy;
@@ -65,6 +69,59 @@ else                                         \
 void free_variables() {
   destroy_nodes(variable_list, free);
   variable_list = NIL;
+  if (variable_index != NULL)
+    free(variable_index);
+  variable_index = NULL;
+  variable_index_valid = FALSE;
+}
+
+
+/**********************************************************************
+ * find_variable_record
+ *
+ * Find the VARIABLE with the given name through a hashed index over
+ * variable_list, building the index first if variables have been added.
+ * As with search, the most recently added variable of a name wins.
+ **********************************************************************/
+VARIABLE *find_variable_record(const char *name) {
+  LIST vars;
+  VARIABLE *this_var;
+  int mask;
+  int index;
+  int var_count;
+
+  if (!variable_index_valid) {
+    var_count = count (variable_list);
+    for (variable_index_bits = 6;
+      (1 << variable_index_bits) < var_count * 2; variable_index_bits++);
+    if (variable_index != NULL)
+      free(variable_index);
+    variable_index = (VARIABLE **) malloc ((1 << variable_index_bits) *
+      sizeof (VARIABLE *));
+    for (index = 0; index < (1 << variable_index_bits); index++)
+      variable_index[index] = NULL;
+    mask = (1 << variable_index_bits) - 1;
+    vars = variable_list;
+    iterate(vars) {
+      this_var = (VARIABLE *) first (vars);
+      index = hash (variable_index_bits, (void *) this_var->string,
+        strlen (this_var->string));
+      while (variable_index[index] != NULL
+        && strcmp (variable_index[index]->string, this_var->string))
+        index = (index + 1) & mask;
+      if (variable_index[index] == NULL)
+        variable_index[index] = this_var;
+    }
+    variable_index_valid = TRUE;
+  }
+  mask = (1 << variable_index_bits) - 1;
+  index = hash (variable_index_bits, (void *) name, strlen (name));
+  while (variable_index[index] != NULL) {
+    if (strcmp (variable_index[index]->string, name) == 0)
+      return variable_index[index];
+    index = (index + 1) & mask;
+  }
+  return NULL;
 }
 /**********************************************************************
  * add_ptr_variable
@@ -88,6 +145,7 @@ void add_ptr_variable(void *address,
 
   *((void **) this_var->address) = default_value.ptr_part;
   variable_list = push (variable_list, this_var);
+  variable_index_valid = FALSE;
 }
 
 
@@ -113,6 +171,7 @@ void add_32bit_variable(void *address,
 
   *((int *) this_var->address) = default_value.int_part;
   variable_list = push (variable_list, this_var);
+  variable_index_valid = FALSE;
 }
 
 
@@ -227,8 +286,7 @@ void read_variables(const char *filename) {
         && this_string[x] != '\t'; x++);
       this_string[x] = '\0';
       /* Find variable record */
-      this_var = (VARIABLE *) first (search (variable_list, this_string,
-        same_var_name));
+      this_var = find_variable_record (this_string);
       if (this_var == 0) {
         cprintf ("error: Could not find variable '%s'\n", this_string);
         exit (1);                //?err_exit ();
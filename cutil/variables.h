@@ -155,6 +155,8 @@ void int_read(VARIABLE *variable, char *string);
 
 void int_write(VARIABLE *variable, char *string);
 
+VARIABLE *find_variable_record(const char *name);
+
 void read_variables(const char *filename);
 
 int same_var_name(void *item1,   //VARIABLE *variable,
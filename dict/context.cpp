@@ -31,11 +31,34 @@
 #include <string.h>
 #include <math.h>
 
+/*----------------------------------------------------------------------
+              M a c r o s
+----------------------------------------------------------------------*/
+/* Case classes, also the columns of the case state table */
+#define CASE_PUNCT     0
+#define CASE_UPPER     1
+#define CASE_LOWER     2
+#define CASE_DIGIT     3
+
+/* Punctuation kinds, the first five index punctuation_types */
+#define PUNCT_PERIOD   0         /* .        after a letter  */
+#define PUNCT_OPEN     1         /* { [ (    before a letter */
+#define PUNCT_CLOSE    2         /* } ] )    after a letter  */
+#define PUNCT_MID      3         /* : ; ! - , ? after a letter */
+#define PUNCT_QUOTE    4         /* ` " '    anywhere        */
+#define PUNCT_ALPHA    5
+#define PUNCT_DIGIT    6
+#define PUNCT_BAD      7
+
 /*----------------------------------------------------------------------
               V a r i a b l e s
 ----------------------------------------------------------------------*/
 static FILE *choice_file = NULL; /* File to save choices */
 
+static char char_tables_made = FALSE;
+static UINT8 case_class[256];    /* Case class of each char */
+static UINT8 punct_kind[256];    /* Punctuation kind of each char */
+
 /*----------------------------------------------------------------------
               F u n c t i o n s
 ----------------------------------------------------------------------*/
@@ -50,6 +73,47 @@ void close_choices() {
 }
 
 
+/**********************************************************************
+ * make_char_tables
+ *
+ * Classify every character once for the case and punctuation rules so
+ * that the word checks need only a table lookup per character.
+ **********************************************************************/
+static void make_char_tables() {
+  int ch;
+
+  for (ch = 0; ch < 256; ch++) {
+    if (islower (ch))
+      case_class[ch] = CASE_LOWER;
+    else if (isupper (ch))
+      case_class[ch] = CASE_UPPER;
+    else if (isdigit (ch))
+      case_class[ch] = CASE_DIGIT;
+    else
+      case_class[ch] = CASE_PUNCT;
+
+    if (isalpha (ch))
+      punct_kind[ch] = PUNCT_ALPHA;
+    else if (isdigit (ch))
+      punct_kind[ch] = PUNCT_DIGIT;
+    else if (ch == '.')
+      punct_kind[ch] = PUNCT_PERIOD;
+    else if (ch == '{' || ch == '[' || ch == '(')
+      punct_kind[ch] = PUNCT_OPEN;
+    else if (ch == '}' || ch == ']' || ch == ')')
+      punct_kind[ch] = PUNCT_CLOSE;
+    else if (ch == ':' || ch == ';' || ch == '!' ||
+      ch == '-' || ch == ',' || ch == '?')
+      punct_kind[ch] = PUNCT_MID;
+    else if (ch == '`' || ch == '\"' || ch == '\'')
+      punct_kind[ch] = PUNCT_QUOTE;
+    else
+      punct_kind[ch] = PUNCT_BAD;
+  }
+  char_tables_made = TRUE;
+}
+
+
 /**********************************************************************
  * fix_quotes
  *
@@ -78,66 +142,43 @@ int punctuation_ok(const char *word) {
   int trailing = 0;
   int num_puncts = 0;
   register int x;
-  register char ch;
+  register int kind;
 
+  if (!char_tables_made)
+    make_char_tables();
   for (x = 0; x < 5; x++)
     punctuation_types[x] = 0;
 
-  for (x = 0; x < strlen (word); x++) {
+  for (x = 0; word[x] != '\0'; x++) {
+    kind = punct_kind[(unsigned char) word[x]];
 
-    if (isalpha (word[x])) {
+    if (kind == PUNCT_ALPHA) {
       if (trailing &&
-        !(isalpha (word[x - 1]) ||
+        !(punct_kind[(unsigned char) word[x - 1]] == PUNCT_ALPHA ||
         (word[x - 1] == '\'' &&
         (word[x] == 's' || word[x] == 'd' || word[x] == 'l')) ||
         (word[x - 1] == '-')))
         return (-1);
       trailing = 1;
     }
-    else {
-      ch = word[x];
-
-      if (ch == '.' && trailing) {
-        if (punctuation_types[0])
-          return (-1);
-        (punctuation_types[0])++;
-      }
-
-      else if (((ch == '{') || (ch == '[') || (ch == '(')) && !trailing) {
-        if (punctuation_types[1])
-          return (-1);
-        (punctuation_types[1])++;
-      }
-
-      else if (((ch == '}') || (ch == ']') || (ch == ')')) && trailing) {
-        if (punctuation_types[2])
-          return (-1);
-        (punctuation_types[2])++;
-      }
-
-      else if (((ch == ':') ||
-        (ch == ';') ||
-        (ch == '!') ||
-      (ch == '-') || (ch == ',') || (ch == '?')) && trailing) {
-        if (punctuation_types[3])
-          return (-1);
-        (punctuation_types[3])++;
-        if (ch == '-')
-          punctuation_types[3] = 0;
+    else if (kind == PUNCT_QUOTE) {
+      if ((word[x + 1] == '`') || (word[x + 1] == '\'')) {
+        x++;
       }
-
-      else if ((ch == '`') || (ch == '\"') || (ch == '\'')) {
-        if ((word[x + 1] == '`') || (word[x + 1] == '\'')) {
-          x++;
-        }
-        (punctuation_types[4])++;
-        if (punctuation_types[4] > 2)
-          return (-1);
-      }
-
-      else if (!isdigit (ch))
+      (punctuation_types[PUNCT_QUOTE])++;
+      if (punctuation_types[PUNCT_QUOTE] > 2)
         return (-1);
     }
+    else if (kind != PUNCT_DIGIT) {
+      /* opening brackets must lead, the rest must trail */
+      if (kind == PUNCT_BAD || (kind == PUNCT_OPEN) == (trailing != 0))
+        return (-1);
+      if (punctuation_types[kind])
+        return (-1);
+      (punctuation_types[kind])++;
+      if (word[x] == '-')
+        punctuation_types[PUNCT_MID] = 0;
+    }
   }
 
   for (x = 0; x < 5; x++) {
@@ -182,16 +223,11 @@ int case_ok(const char *word) {
   register int state = 0;
   register int x;
 
-  for (x = 0; x < strlen (word); x++) {
+  if (!char_tables_made)
+    make_char_tables();
+  for (x = 0; word[x] != '\0'; x++) {
 
-    if (islower (word[x]))
-      state = case_state_table[state][2];
-    else if (isupper (word[x]))
-      state = case_state_table[state][1];
-    else if (isdigit (word[x]))
-      state = case_state_table[state][3];
-    else
-      state = case_state_table[state][0];
+    state = case_state_table[state][case_class[(unsigned char) word[x]]];
 
     if (debug_3)
       cprintf ("Case state = %d, char = %c\n", state, word[x]);
@@ -199,7 +235,7 @@ int case_ok(const char *word) {
     if (state == -1) {
                                  /* Handle ACCRONYMs */
       if (word[x] == 's' &&
-        !isalpha (word[x + 1]) && !isdigit (word[x + 1]))
+        case_class[(unsigned char) word[x + 1]] == CASE_PUNCT)
         state = last_state;
       else
         return (FALSE);
@@ -104,12 +104,12 @@ INT32 letter_is_okay(EDGE_ARRAY dawg,
                      const char *word,
                      INT32 word_end) {
   EDGE_REF     edge;
-  STRING dummy_word(word);  // Auto-deleting string fixes memory leak.
 
+  /* The word is only copied on the paths that need to edit it */
   if (*node == NO_EDGE) {        /* Trailing punctuation */
-    if (trailing_punc (dummy_word [char_index])
+    if (trailing_punc (word [char_index])
       && (!trailing_punc (prevchar)
-      || punctuation_ok(dummy_word.string())>=0))
+      || punctuation_ok(word)>=0))
       return (TRUE);
     else
       return (FALSE);
@@ -118,18 +118,19 @@ INT32 letter_is_okay(EDGE_ARRAY dawg,
     /* Leading punctuation */
     if (*node == 0                           &&
       char_index != 0                      &&
-      isalpha (dummy_word [char_index])          &&
-      ! leading_punc (dummy_word [char_index-1]) &&
-    dummy_word [char_index-1] != '-') {
+      isalpha (word [char_index])          &&
+      ! leading_punc (word [char_index-1]) &&
+    word [char_index-1] != '-') {
       return (FALSE);
     }
   }
   /* Handle compund words */
-  if (dummy_word [char_index] == '-') {
+  if (word [char_index] == '-') {
     if (char_index>0 && !word_end
       && word [char_index-1] == '-'
       && word [char_index+1] == '-')
       return FALSE;              /*not allowed*/
+    STRING dummy_word(word);  // Auto-deleting string fixes memory leak.
     dummy_word [char_index] = (char) 0;
     if (word_in_dawg (dawg, dummy_word.string())) {
       dummy_word [char_index] = '-';
@@ -142,10 +143,10 @@ INT32 letter_is_okay(EDGE_ARRAY dawg,
     }
   }
   /* Check the DAWG */
-  edge = edge_char_of (dawg, *node, dummy_word [char_index], word_end);
+  edge = edge_char_of (dawg, *node, word [char_index], word_end);
 
   if (edge != NO_EDGE) {         /* Normal edge in DAWG */
-    if (case_sensative || case_is_okay (dummy_word, char_index)) {
+    if (case_sensative || case_is_okay (word, char_index)) {
                                  //next_node (dawg, edge);
       *node = (dawg)[edge] & NO_EDGE;
       return (TRUE);
@@ -157,7 +158,7 @@ INT32 letter_is_okay(EDGE_ARRAY dawg,
   else {
     /* Leading punctuation */
     if (leading_punc (word [char_index]) &&
-    (char_index == 0  ||  leading_punc (dummy_word [char_index-1]))) {
+    (char_index == 0  ||  leading_punc (word [char_index-1]))) {
       *node = 0;
       if (leading_punc (prevchar) || punctuation_ok (word)>=0)
         return (TRUE);
@@ -165,6 +166,7 @@ INT32 letter_is_okay(EDGE_ARRAY dawg,
         return FALSE;
     }
     /* Trailing punctuation */
+    STRING dummy_word(word);
     if (verify_trailing_punct (dawg, &dummy_word[0], char_index)) {
       *node = NO_EDGE;
       return (TRUE);
@@ -53,12 +53,27 @@ int permutation_count;           // Used in metrics.cpp.
 #define NON_WERD               1.25
 #define GARBAGE_STRING         1.5
 #define MAX_PERM_LENGTH         128
+#define WORD_MEMO_SIZE         4096   /* Must be a power of 2 */
+#define MAX_MEMO_LENGTH        23
+
+typedef struct
+{
+  char word[MAX_MEMO_LENGTH + 1];  /* String looked up */
+  char case_flag;                  /* case_sensative at the time */
+  char system_word;                /* Found in word_dawg */
+  char user_word;                  /* Found in user_words */
+  char doc_word;                   /* Found in document_words */
+  int doc_generation;              /* doc_word is for this one */
+} WORD_MEMO;
 
 static EDGE_ARRAY pending_words;
 static EDGE_ARRAY document_words;
 static EDGE_ARRAY user_words;
 static EDGE_ARRAY word_dawg;
 
+static WORD_MEMO word_memo[WORD_MEMO_SIZE];
+static int doc_generation = 1;   /* Bumped when document_words grows */
+
 make_toggle_var (adjust_debug, 0, make_adjust_debug,
 8, 13, set_adjust_debug, "Adjustment Debug");
 
@@ -934,6 +949,7 @@ void add_document_word(A_CHOICE *best_choice) {
     fclose(doc_word_file);
   }
   add_word_to_dawg(document_words, string, MAX_DOC_EDGES, RESERVED_DOC_EDGES);
+  doc_generation++;
   case_sensative = FALSE;
 }
 
@@ -983,6 +999,19 @@ adjust_non_word (A_CHOICE * best_choice, float certainties[]) {
 }
 
 
+/**********************************************************************
+ * clear_document_words
+ *
+ * Forget the words of the document dictionary and those pending a
+ * second sighting, as at start up, for a new document.
+ **********************************************************************/
+void clear_document_words() {
+  initialize_dawg(document_words, MAX_DOC_EDGES);
+  initialize_dawg(pending_words, MAX_DOC_EDGES);
+  doc_generation++;              /* Memoed doc answers are stale */
+}
+
+
 /**********************************************************************
  * init_permute
  *
@@ -1019,9 +1048,11 @@ void init_permute() {
   strcat (name, "tessdata/user-words");
   read_word_list(name, user_words, MAX_USER_EDGES, USER_RESERVED_EDGES);
   case_sensative = FALSE;
+  memset (word_memo, 0, sizeof (word_memo));
 }
 
 void end_permute() {
+  memset (word_memo, 0, sizeof (word_memo));
   memfree(word_dawg);
   word_dawg = NULL;
   memfree(document_words);
@@ -1566,13 +1597,68 @@ A_CHOICE *permute_words(CHOICES_LIST char_choices, float rating_limit) {
 }
 
 
+/**********************************************************************
+ * find_word_memo
+ *
+ * Find the memo of the system and user DAWG lookups for this string,
+ * making it if need be. The lookups depend on case_sensative, so that
+ * is part of the key. Returns NULL if the string is too long to memo.
+ **********************************************************************/
+static WORD_MEMO *find_word_memo(const char *string) {
+  WORD_MEMO *memo;
+  UINT32 hash = 0;
+  int length;
+
+  for (length = 0; string[length] != '\0'; length++) {
+    if (length >= MAX_MEMO_LENGTH)
+      return (NULL);
+    hash = hash * 31 + (unsigned char) string[length];
+  }
+  if (length == 0)
+    return (NULL);
+  hash = hash * 2 + (case_sensative != 0);
+  memo = &word_memo[hash & (WORD_MEMO_SIZE - 1)];
+  if (memo->case_flag == (case_sensative != 0)
+    && strcmp (memo->word, string) == 0)
+    return (memo);
+
+  strcpy (memo->word, string);
+  memo->case_flag = case_sensative != 0;
+  memo->system_word = word_in_dawg (word_dawg, string) != 0;
+  memo->user_word = !memo->system_word
+    && word_in_dawg (user_words, string) != 0;
+  memo->doc_word = FALSE;
+  memo->doc_generation = 0;      /* Not looked up yet */
+  return (memo);
+}
+
+
 /**********************************************************************
  * valid_word
  *
- * Check all the DAWGs to see if this word is in any of them.
+ * Check all the DAWGs to see if this word is in any of them. The system
+ * and user DAWGs do not change once loaded, so their answers are
+ * remembered. The document DAWG answer is kept until a word is added.
  **********************************************************************/
 int valid_word(const char *string) {
   int result = NO_PERM;
+  WORD_MEMO *memo;
+
+  memo = find_word_memo (string);
+  if (memo != NULL) {
+    if (memo->system_word)
+      return (SYSTEM_DAWG_PERM);
+    if (memo->doc_generation != doc_generation) {
+      memo->doc_word = word_in_dawg (document_words, string) != 0;
+      memo->doc_generation = doc_generation;
+    }
+    if (memo->doc_word)
+      result = DOC_DAWG_PERM;
+    else if (memo->user_word)
+      result = USER_DAWG_PERM;
+    case_sensative = FALSE;
+    return (result);
+  }
 
   if (word_in_dawg (word_dawg, string))
     result = SYSTEM_DAWG_PERM;
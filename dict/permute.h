@@ -50,6 +50,8 @@ void add_document_word(A_CHOICE *best_choice);
 
 void adjust_non_word (A_CHOICE * best_choice, float certainties[]);
 
+void clear_document_words();
+
 void init_permute();
 void end_permute();
 
@@ -53,18 +53,29 @@ typedef LIST AMBIG_TABLE;
 typedef struct
 {
   UINT8 Class;
-  UINT16 NumChunks;
   float Certainty;
 }
 
 
 CHAR_CHOICE;
 
+/* Segmentations are shared by all choices made with the same blob widths
+  so that a split only has to update each distinct segmentation once. */
+typedef struct
+{
+  int RefCount;
+  int Length;
+  UINT16 NumChunks[MAX_NUM_CHUNKS];
+} SEGMENTATION_STRUCT;
+typedef SEGMENTATION_STRUCT *SEGMENTATION;
+
 typedef struct
 {
   float Rating;
   float Certainty;
   FLOAT32 AdjustFactor;
+  UINT32 Hash;
+  SEGMENTATION Segmentation;
   int Length;
   CHAR_CHOICE Blob[1];
 } VIABLE_CHOICE_STRUCT;
@@ -86,6 +97,7 @@ EXPANDED_CHOICE;
 #define BestCertainty(Choices)  (((VIABLE_CHOICE) first (Choices))->Certainty)
 #define BestRating(Choices) (((VIABLE_CHOICE) first (Choices))->Rating)
 #define BestFactor(Choices) (((VIABLE_CHOICE) first (Choices))->AdjustFactor)
+#define NumChunksOf(Choice,i)  ((Choice)->Segmentation->NumChunks[i])
 
 #define AmbigThreshold(F1,F2)	(((F2) - (F1)) * AmbigThresholdGain - \
 				AmbigThresholdOffset)
@@ -93,7 +105,7 @@ EXPANDED_CHOICE;
 /*---------------------------------------------------------------------------
           Private Function Prototoypes
 ----------------------------------------------------------------------------*/
-void AddNewChunk(VIABLE_CHOICE Choice, int Blob);
+void AddNewChunk(SEGMENTATION Segmentation, int Blob);
 
 int AmbigsFound(char *Word,
                 char *CurrentChar,
@@ -113,6 +125,8 @@ AMBIG_TABLE *FillAmbigTable();
 int FreeBadChoice(void *item1,   //VIABLE_CHOICE                 Choice,
                   void *item2);  //EXPANDED_CHOICE                       *BestChoice);
 
+void FreeViableChoice(void *item);  //VIABLE_CHOICE             Choice
+
 int LengthOfShortestAlphaRun(register char *Word);
 
 VIABLE_CHOICE NewViableChoice (A_CHOICE * Choice,
@@ -124,6 +138,10 @@ void ReplaceDuplicateChoice (VIABLE_CHOICE OldChoice,
 A_CHOICE * NewChoice,
 FLOAT32 AdjustFactor, float Certainties[]);
 
+SEGMENTATION ShareSegmentation(int Length);
+
+UINT32 StringHash(const char *String);
+
 int StringSameAs(const char *String, VIABLE_CHOICE ViableChoice);
 
 int UniformCertainties(CHOICES_LIST Choices, A_CHOICE *BestChoice);
@@ -149,6 +167,9 @@ static VIABLE_CHOICE BestRawChoice = NULL;
 static LIST BestChoices = NIL;
 static PIECES_STATE CurrentSegmentation;
 
+/* distinct segmentations referenced by BestRawChoice and BestChoices */
+static LIST Segmentations = NIL;
+
 make_float_var (NonDictCertainty, -2.50, MakeNonDictCertainty,
 17, 2, SetNonDictCertainty,
 "Certainty threshold for non-dict words");
@@ -507,7 +528,7 @@ FLOAT32 RatingMargin, FLOAT32 Thresholds[]) {
     AvgRating = 0.0;
     NumErrorChunks = 0;
 
-    for (j = 0; j < Choice->Blob[i].NumChunks; j++, Chunk++)
+    for (j = 0; j < NumChunksOf (Choice, i); j++, Chunk++)
     if (Choice->Blob[i].Class != BestRaw.ChunkClass[Chunk]) {
       AvgRating += BestRaw.ChunkCertainty[Chunk];
       NumErrorChunks++;
@@ -568,10 +589,11 @@ void InitChoiceAccum() {
   BLOB_WIDTH *BlobWidth, *End;
 
   if (BestRawChoice)
-    memfree(BestRawChoice);
+    FreeViableChoice(BestRawChoice);
 
   if (BestChoices)
-    destroy_nodes(BestChoices, memfree);
+    destroy_nodes(BestChoices, FreeViableChoice);
+  assert (Segmentations == NIL);
 
   BestRawChoice = NULL;
   BestChoices = NIL;
@@ -609,7 +631,7 @@ LogNewRawChoice (A_CHOICE * Choice, FLOAT32 AdjustFactor, float Certainties[]) {
     if (ChoiceSameAs (Choice, BestRawChoice))
       ReplaceDuplicateChoice(BestRawChoice, Choice, AdjustFactor, Certainties);
     else {
-      memfree(BestRawChoice);
+      FreeViableChoice(BestRawChoice);
       BestRawChoice = NewViableChoice (Choice, AdjustFactor, Certainties);
     }
   }
@@ -645,23 +667,19 @@ void LogNewSplit(int Blob) {
  **	Parameters:
  **		Blob	index of blob that was split
  **	Globals:
- **		BestRawChoice	current best raw choice
- **		BestChoices	list of best choices found so far
+ **		Segmentations	segmentations of all logged choices
  **	Operation: This routine adds 1 chunk to the specified blob for each
- **		choice in BestChoices and for the BestRawChoice.
+ **		segmentation used by BestChoices and the BestRawChoice.
+ **		Choices share segmentations, so each is updated only once.
  **	Return: none
  **	Exceptions: none
  **	History: Mon May 20 11:38:56 1991, DSJ, Created.
  */
-  LIST Choices;
-
-  if (BestRawChoice) {
-    AddNewChunk(BestRawChoice, Blob);
-  }
+  LIST Segmentation;
 
-  Choices = BestChoices;
-  iterate(Choices) {
-    AddNewChunk ((VIABLE_CHOICE) first (Choices), Blob);
+  Segmentation = Segmentations;
+  iterate(Segmentation) {
+    AddNewChunk ((SEGMENTATION) first (Segmentation), Blob);
   }
 
 }                                /* LogNewSplit */
@@ -690,6 +708,7 @@ FLOAT32 AdjustFactor, float Certainties[]) {
   VIABLE_CHOICE NewChoice;
   LIST Choices;
   FLOAT32 Threshold;
+  UINT32 Hash;
 
   if (!KeepWordChoices)
     return;
@@ -705,9 +724,11 @@ FLOAT32 AdjustFactor, float Certainties[]) {
 
   /* see if a choice with the same text string has already been found */
   NewChoice = NULL;
+  Hash = StringHash (class_string (Choice));
   Choices = BestChoices;
   iterate(Choices) {
-    if (ChoiceSameAs (Choice, (VIABLE_CHOICE) first (Choices)))
+    if (((VIABLE_CHOICE) first (Choices))->Hash == Hash &&
+      ChoiceSameAs (Choice, (VIABLE_CHOICE) first (Choices)))
       if (class_probability (Choice) < BestRating (Choices))
         NewChoice = (VIABLE_CHOICE) first (Choices);
     else
@@ -728,7 +749,7 @@ FLOAT32 AdjustFactor, float Certainties[]) {
   if (count (BestChoices) > tessedit_truncate_wordchoice_log) {
     Choices =
       (LIST) nth_cell (BestChoices, tessedit_truncate_wordchoice_log);
-    destroy_nodes (rest (Choices), Efree);
+    destroy_nodes (rest (Choices), FreeViableChoice);
     set_rest(Choices, NIL);
   }
 
@@ -824,30 +845,30 @@ void SettupStopperPass2() {
               Private Code
 ----------------------------------------------------------------------------**/
 /*---------------------------------------------------------------------------*/
-void AddNewChunk(VIABLE_CHOICE Choice, int Blob) {
+void AddNewChunk(SEGMENTATION Segmentation, int Blob) {
 /*
  **	Parameters:
- **		Choice	choice to add a new chunk to
- **		Blob	index of blob being split
+ **		Segmentation	segmentation to add a new chunk to
+ **		Blob		index of blob being split
  **	Globals: none
  **	Operation: This routine increments the chunk count of the character
- **		in Choice which corresponds to Blob.
+ **		in Segmentation which corresponds to Blob.
  **	Return: none
  **	Exceptions: none
  **	History: Mon May 20 11:43:27 1991, DSJ, Created.
  */
   int i, LastChunk;
 
-  for (i = 0, LastChunk = 0; i < Choice->Length; i++) {
-    LastChunk += Choice->Blob[i].NumChunks;
+  for (i = 0, LastChunk = 0; i < Segmentation->Length; i++) {
+    LastChunk += Segmentation->NumChunks[i];
     if (Blob < LastChunk) {
-      (Choice->Blob[i].NumChunks)++;
+      (Segmentation->NumChunks[i])++;
       return;
     }
   }
   mem_tidy (1);
-  cprintf ("AddNewChunk failed:Choice->Length=%d, LastChunk=%d, Blob=%d\n",
-    Choice->Length, LastChunk, Blob);
+  cprintf ("AddNewChunk failed:Length=%d, LastChunk=%d, Blob=%d\n",
+    Segmentation->Length, LastChunk, Blob);
   assert(FALSE);  /* this should never get executed */
 
 }                                /* AddNewChunk */
@@ -987,7 +1008,7 @@ void ExpandChoice(VIABLE_CHOICE Choice, EXPANDED_CHOICE *ExpandedChoice) {
 
   ExpandedChoice->Choice = Choice;
   for (i = 0, Chunk = 0; i < Choice->Length; i++)
-  for (j = 0; j < Choice->Blob[i].NumChunks; j++, Chunk++) {
+  for (j = 0; j < NumChunksOf (Choice, i); j++, Chunk++) {
     ExpandedChoice->ChunkCertainty[Chunk] = Choice->Blob[i].Certainty;
     ExpandedChoice->ChunkClass[Chunk] = Choice->Blob[i].Class;
   }
@@ -1082,11 +1103,11 @@ int FreeBadChoice(void *item1,    //VIABLE_CHOICE                 Choice,
     Choice->AdjustFactor);
 
   for (i = 0, Chunk = 0; i < Choice->Length; i++)
-    for (j = 0; j < Choice->Blob[i].NumChunks; j++, Chunk++)
+    for (j = 0; j < NumChunksOf (Choice, i); j++, Chunk++)
       if (Choice->Blob[i].Class != BestChoice->ChunkClass[Chunk] &&
     Choice->Blob[i].Certainty - BestChoice->ChunkCertainty[Chunk] <
       Threshold) {
-        memfree(Choice);
+        FreeViableChoice(Choice);
     return (TRUE);
   }
 
@@ -1095,6 +1116,31 @@ int FreeBadChoice(void *item1,    //VIABLE_CHOICE                 Choice,
 }                                /* FreeBadChoice */
 
 
+/*---------------------------------------------------------------------------*/
+void FreeViableChoice(void *item) {  //VIABLE_CHOICE            Choice
+/*
+ **	Parameters:
+ **		Choice		choice to be freed
+ **	Globals:
+ **		Segmentations	segmentations of all logged choices
+ **	Operation: Free Choice and release its segmentation, freeing the
+ **		segmentation as well if no other choice uses it.
+ **	Return: none
+ **	Exceptions: none
+ **	History: Mon Oct 19 14:02:11 2026, Created.
+ */
+  VIABLE_CHOICE Choice = (VIABLE_CHOICE) item;
+  SEGMENTATION Segmentation = Choice->Segmentation;
+
+  if (--Segmentation->RefCount == 0) {
+    Segmentations = delete_d (Segmentations, Segmentation, is_same_node);
+    memfree(Segmentation);
+  }
+  memfree(Choice);
+
+}                                /* FreeViableChoice */
+
+
 /*---------------------------------------------------------------------------*/
 int LengthOfShortestAlphaRun(register char *Word) {
 /*
@@ -1137,8 +1183,8 @@ NewViableChoice (A_CHOICE * Choice, FLOAT32 AdjustFactor, float Certainties[]) {
  **	Globals:
  **		CurrentSegmentation	segmentation corresponding to Choice
  **	Operation: Allocate a new viable choice data structure, copy
- **		Choice, Certainties, and CurrentSegmentation into it,
- **		and return a pointer to it.
+ **		Choice and Certainties into it, attach the shared copy of
+ **		CurrentSegmentation, and return a pointer to it.
  **	Return: Ptr to new viable choice.
  **	Exceptions: none
  **	History: Thu May 16 15:28:29 1991, DSJ, Created.
@@ -1147,7 +1193,6 @@ NewViableChoice (A_CHOICE * Choice, FLOAT32 AdjustFactor, float Certainties[]) {
   int Length;
   char *Word;
   CHAR_CHOICE *NewChar;
-  BLOB_WIDTH *BlobWidth;
 
   Length = strlen (class_string (Choice));
   assert (Length <= MAX_NUM_CHUNKS && Length > 0);
@@ -1158,14 +1203,14 @@ NewViableChoice (A_CHOICE * Choice, FLOAT32 AdjustFactor, float Certainties[]) {
   NewChoice->Rating = class_probability (Choice);
   NewChoice->Certainty = class_certainty (Choice);
   NewChoice->AdjustFactor = AdjustFactor;
+  NewChoice->Hash = StringHash (class_string (Choice));
+  NewChoice->Segmentation = ShareSegmentation (Length);
   NewChoice->Length = Length;
 
   for (Word = class_string (Choice),
-    NewChar = &(NewChoice->Blob[0]),
-    BlobWidth = CurrentSegmentation;
-  *Word; Word++, NewChar++, Certainties++, BlobWidth++) {
+    NewChar = &(NewChoice->Blob[0]);
+  *Word; Word++, NewChar++, Certainties++) {
     NewChar->Class = *Word;
-    NewChar->NumChunks = *BlobWidth;
     NewChar->Certainty = *Certainties;
   }
 
@@ -1201,13 +1246,13 @@ void PrintViableChoice(FILE *File, const char *Label, VIABLE_CHOICE Choice) {
 
   for (i = 0; i < Choice->Length; i++) {
     fprintf (File, "  %c", Choice->Blob[i].Class);
-    for (j = 0; j < Choice->Blob[i].NumChunks - 1; j++)
+    for (j = 0; j < NumChunksOf (Choice, i) - 1; j++)
       fprintf (File, "   ");
   }
   fprintf (File, "\n");
 
   for (i = 0; i < Choice->Length; i++) {
-    for (j = 0; j < Choice->Blob[i].NumChunks; j++)
+    for (j = 0; j < NumChunksOf (Choice, i); j++)
       fprintf (File, "%3d", (int) (Choice->Blob[i].Certainty * -10.0));
   }
   fprintf (File, "\n");
@@ -1240,22 +1285,73 @@ FLOAT32 AdjustFactor, float Certainties[]) {
  */
   char *Word;
   CHAR_CHOICE *NewChar;
-  BLOB_WIDTH *BlobWidth;
+  SEGMENTATION Segmentation;
 
   OldChoice->Rating = class_probability (NewChoice);
   OldChoice->Certainty = class_certainty (NewChoice);
   OldChoice->AdjustFactor = AdjustFactor;
 
+  Segmentation = ShareSegmentation (OldChoice->Length);
+  if (--OldChoice->Segmentation->RefCount == 0) {
+    Segmentations = delete_d (Segmentations, OldChoice->Segmentation,
+      is_same_node);
+    memfree (OldChoice->Segmentation);
+  }
+  OldChoice->Segmentation = Segmentation;
+
   for (Word = class_string (NewChoice),
-    NewChar = &(OldChoice->Blob[0]),
-    BlobWidth = CurrentSegmentation;
-  *Word; Word++, NewChar++, Certainties++, BlobWidth++) {
-    NewChar->NumChunks = *BlobWidth;
+    NewChar = &(OldChoice->Blob[0]);
+  *Word; Word++, NewChar++, Certainties++) {
     NewChar->Certainty = *Certainties;
   }
 }                                /* ReplaceDuplicateChoice */
 
 
+/*---------------------------------------------------------------------------*/
+SEGMENTATION ShareSegmentation(int Length) {
+/*
+ **	Parameters:
+ **		Length		number of blobs in the choice being logged
+ **	Globals:
+ **		CurrentSegmentation	blob widths for current segmentation
+ **		Segmentations		segmentations of all logged choices
+ **	Operation: Find the logged segmentation with the same first Length
+ **		blob widths as CurrentSegmentation, or make a new one, and
+ **		add a reference to it.  Permutations of one segmentation
+ **		all end up sharing a single copy.
+ **	Return: Referenced segmentation.
+ **	Exceptions: none
+ **	History: Mon Oct 19 14:02:11 2026, Created.
+ */
+  LIST Segs;
+  SEGMENTATION Segmentation;
+  int i;
+
+  Segs = Segmentations;
+  iterate(Segs) {
+    Segmentation = (SEGMENTATION) first (Segs);
+    if (Segmentation->Length != Length)
+      continue;
+    for (i = 0; i < Length; i++)
+      if (Segmentation->NumChunks[i] != CurrentSegmentation[i])
+        break;
+    if (i == Length) {
+      Segmentation->RefCount++;
+      return (Segmentation);
+    }
+  }
+
+  Segmentation = (SEGMENTATION) Emalloc (sizeof (SEGMENTATION_STRUCT));
+  Segmentation->RefCount = 1;
+  Segmentation->Length = Length;
+  for (i = 0; i < Length; i++)
+    Segmentation->NumChunks[i] = CurrentSegmentation[i];
+  Segmentations = push (Segmentations, Segmentation);
+  return (Segmentation);
+
+}                                /* ShareSegmentation */
+
+
 /*---------------------------------------------------------------------------*/
 int StringSameAs(const char *String, VIABLE_CHOICE ViableChoice) {
 /*
@@ -1285,6 +1381,27 @@ int StringSameAs(const char *String, VIABLE_CHOICE ViableChoice) {
 }                                /* StringSameAs */
 
 
+/*---------------------------------------------------------------------------*/
+UINT32 StringHash(const char *String) {
+/*
+ **	Parameters:
+ **		String		string to be hashed
+ **	Globals: none
+ **	Operation: Compute a hash of String so that choices with different
+ **		text can usually be told apart without comparing strings.
+ **	Return: Hash value.
+ **	Exceptions: none
+ **	History: Mon Oct 19 14:02:11 2026, Created.
+ */
+  UINT32 Hash = 0;
+
+  for (; *String; String++)
+    Hash = Hash * 31 + (UINT8) *String;
+  return (Hash);
+
+}                                /* StringHash */
+
+
 /*---------------------------------------------------------------------------*/
 int UniformCertainties(CHOICES_LIST Choices, A_CHOICE *BestChoice) {
 /*
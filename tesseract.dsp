@@ -97,6 +97,10 @@ SOURCE=.\ccmain\adaptions.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\ccmain\adaptqueue.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\ccmain\applybox.cpp
 # End Source File
 # Begin Source File
@@ -192,6 +196,10 @@ SOURCE=.\ccmain\tstruct.cpp
 
 SOURCE=.\ccmain\werdit.cpp
 # End Source File
+# Begin Source File
+
+SOURCE=.\ccmain\wordcache.cpp
+# End Source File
 # End Group
 # Begin Group "ccstruct"
 
@@ -1029,6 +1037,10 @@ SOURCE=.\ccmain\adaptions.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\ccmain\adaptqueue.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\ccmain\applybox.h
 # End Source File
 # Begin Source File
@@ -1115,6 +1127,10 @@ SOURCE=.\ccmain\tstruct.h
 
 SOURCE=.\ccmain\werdit.h
 # End Source File
+# Begin Source File
+
+SOURCE=.\ccmain\wordcache.h
+# End Source File
 # End Group
 # Begin Group "ccstruct header"
 
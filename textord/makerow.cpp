@@ -664,10 +664,10 @@ BOOL8 find_best_dropout_row(                    //find neighbours
                             BOOL8 testing_on    //correct orientation
                            ) {
   INT32 next_index;              //of neigbouring row
-  INT32 row_offset;              //from current row
   INT32 abs_dist;                //absolute distance
   INT8 row_inc;                  //increment to row_index
   TO_ROW *next_row;              //nextious row
+  TO_ROW_IT next_it = *row_it;   //neighbour iterator
 
   if (testing_on)
     tprintf ("Row at %g(%g), dropout dist=%d,",
@@ -688,9 +688,15 @@ BOOL8 find_best_dropout_row(                    //find neighbours
   }
   if (distance < 0 && !row_it->at_last ()
   || distance >= 0 && !row_it->at_first ()) {
-    row_offset = row_inc;
+    //walk one row at a time and stop at the end of the list; the rows
+    //are in y order, so rows past the end are on the wrong side of this
+    //one and wrapping round would end up comparing the row with itself
     do {
-      next_row = row_it->data_relative (row_offset);
+      if (row_inc > 0)
+        next_it.forward ();
+      else
+        next_it.backward ();
+      next_row = next_it.data ();
       next_index = (INT32) floor (next_row->intercept ());
       if (distance < 0
         && next_index < line_index
@@ -717,11 +723,10 @@ BOOL8 find_best_dropout_row(                    //find neighbours
           return TRUE;           //other is more believable
         }
       }
-      row_offset += row_inc;
     }
     while ((next_index == line_index
       || next_index == line_index + distance + distance)
-      && row_offset < row_it->length ());
+      && !(row_inc > 0 ? next_it.at_last () : next_it.at_first ()));
     if (testing_on)
       tprintf (" keeping\n");
   }
@@ -849,60 +854,55 @@ void compute_occupation_threshold(                    //project blobs
   INT32 high_index;              //in occupation
   INT32 sum;                     //current average
   INT32 divisor;                 //to get thresholds
-  INT32 min_index;               //of min occ
   INT32 min_occ;                 //min in locality
-  INT32 test_index;              //for finding min
+  INT32 *min_queue;              //indices of rising occupation
+  INT32 queue_head;              //oldest, holds window min
+  INT32 queue_tail;              //next free
 
   divisor =
     (INT32) ceil ((low_window + high_window) / textord_occupancy_threshold);
   if (low_window + high_window < line_count) {
-    for (sum = 0, high_index = 0; high_index < low_window; high_index++)
-      sum += occupation[high_index];
-    for (low_index = 0; low_index < high_window; low_index++, high_index++)
+    /*
+    The window min is kept in a queue of indices whose occupations rise
+    from head to tail, so each index is added and dropped only once.
+    */
+    min_queue = (INT32 *) alloc_mem (line_count * sizeof (INT32));
+    if (min_queue == NULL)
+      MEMORY_OUT.error ("compute_occupation_threshold", ABORT, NULL);
+    queue_head = 0;
+    queue_tail = 0;
+    for (sum = 0, high_index = 0; high_index < low_window + high_window;
+    high_index++) {
       sum += occupation[high_index];
-    min_occ = occupation[0];
-    min_index = 0;
-    for (test_index = 1; test_index < high_index; test_index++) {
-      if (occupation[test_index] <= min_occ) {
-        min_occ = occupation[test_index];
-        min_index = test_index;  //find min in region
-      }
+      while (queue_tail > queue_head
+        && occupation[min_queue[queue_tail - 1]] >= occupation[high_index])
+        queue_tail--;
+      min_queue[queue_tail++] = high_index;
     }
+    min_occ = occupation[min_queue[queue_head]];
     for (line_index = 0; line_index < low_window; line_index++)
       thresholds[line_index] = (sum - min_occ) / divisor + min_occ;
     //same out to end
     for (low_index = 0; high_index < line_count; low_index++, high_index++) {
       sum -= occupation[low_index];
       sum += occupation[high_index];
-      if (occupation[high_index] <= min_occ) {
-                                 //find min in region
-        min_occ = occupation[high_index];
-        min_index = high_index;
-      }
+      while (queue_tail > queue_head
+        && occupation[min_queue[queue_tail - 1]] >= occupation[high_index])
+        queue_tail--;
+      min_queue[queue_tail++] = high_index;
                                  //lost min from region
-      if (min_index <= low_index) {
-        min_occ = occupation[low_index + 1];
-        min_index = low_index + 1;
-        for (test_index = low_index + 2; test_index <= high_index;
-        test_index++) {
-          if (occupation[test_index] <= min_occ) {
-            min_occ = occupation[test_index];
-                                 //find min in region
-            min_index = test_index;
-          }
-        }
-      }
+      if (min_queue[queue_head] <= low_index)
+        queue_head++;
+      min_occ = occupation[min_queue[queue_head]];
       thresholds[line_index++] = (sum - min_occ) / divisor + min_occ;
     }
+    free_mem(min_queue);
   }
   else {
     min_occ = occupation[0];
-    min_index = 0;
     for (sum = 0, low_index = 0; low_index < line_count; low_index++) {
-      if (occupation[low_index] < min_occ) {
+      if (occupation[low_index] < min_occ)
         min_occ = occupation[low_index];
-        min_index = low_index;
-      }
       sum += occupation[low_index];
     }
     line_index = 0;
@@ -44,6 +44,8 @@ EXTERN BOOL_VAR (textord_disable_pitch_test, FALSE,
 "Turn off dp fixed pitch algorithm");
 EXTERN BOOL_VAR (textord_fast_pitch_test, FALSE,
 "Do even faster pitch algorithm");
+EXTERN BOOL_VAR (textord_autocorr_pitch_test, FALSE,
+"Pick pitch from projection autocorrelation");
 EXTERN BOOL_VAR (textord_debug_pitch_metric, FALSE,
 "Write full metric stuff");
 EXTERN BOOL_VAR (textord_show_row_cuts, FALSE, "Draw row-level cuts");
@@ -1219,6 +1221,10 @@ float tune_row_pitch(                             //find fp cells
       best_sp_sd,
     //space sd
       best_mid_cuts, best_cells, testing_on);
+  if (textord_autocorr_pitch_test)
+    return tune_row_pitch3 (row, projection, projection_left,
+      projection_right, space_size, initial_pitch,
+      best_sp_sd, best_mid_cuts, best_cells, testing_on);
   if (textord_disable_pitch_test) {
     best_sp_sd = initial_pitch;
     return initial_pitch;
@@ -1413,6 +1419,138 @@ float tune_row_pitch2(                             //find fp cells
 }
 
 
+/**********************************************************************
+ * tune_row_pitch3
+ *
+ * Pick the pitch within textord_pitch_range of the initial guess at
+ * which the vertical projection best correlates with itself, then run
+ * the dp fit at that pitch only. The initial pitch is also fitted if
+ * it differs, and the better of the two is kept. This replaces the
+ * sweep of dp fits done by tune_row_pitch.
+ **********************************************************************/
+
+float tune_row_pitch3(                             //find fp cells
+                      TO_ROW *row,                 //row to do
+                      STATS *projection,           //vertical projection
+                      INT16 projection_left,       //edge of projection
+                      INT16 projection_right,      //edge of projection
+                      float space_size,            //size of blank
+                      float &initial_pitch,        //guess at pitch
+                      float &best_sp_sd,           //space sd
+                      INT16 &best_mid_cuts,        //no of cheap cuts
+                      ICOORDELT_LIST *best_cells,  //row cells
+                      BOOL8 testing_on             //inidividual words
+                     ) {
+  INT16 best_delta;              //offset of best peak
+  INT16 mid_cuts;                //cheap cuts
+  float pitch_sd;                //current sd
+  float best_sd;                 //best result
+  float sp_sd;                   //space sd
+  ICOORDELT_LIST test_cells;     //row cells
+  ICOORDELT_IT best_it;          //start of best list
+
+  if (textord_disable_pitch_test) {
+    best_sp_sd = initial_pitch;
+    return initial_pitch;
+  }
+  best_delta = autocorr_pitch_delta (projection, projection_left,
+    projection_right, initial_pitch, textord_pitch_range);
+  if (testing_on)
+    tprintf ("tune_row_pitch3:start pitch=%g, best_delta=%d\n",
+      initial_pitch, best_delta);
+  best_sd = compute_pitch_sd (row, projection, projection_left,
+    projection_right, space_size,
+    initial_pitch + best_delta, best_sp_sd,
+    best_mid_cuts, best_cells, testing_on);
+  if (best_delta != 0) {
+    pitch_sd = compute_pitch_sd (row, projection, projection_left,
+      projection_right, space_size, initial_pitch,
+      sp_sd, mid_cuts, &test_cells, testing_on);
+    if (pitch_sd < best_sd) {
+      best_sd = pitch_sd;
+      best_mid_cuts = mid_cuts;
+      best_sp_sd = sp_sd;
+      best_delta = 0;
+      best_cells->clear ();
+      best_it.set_to_list (best_cells);
+      best_it.add_list_after (&test_cells);
+    }
+    else
+      test_cells.clear ();
+  }
+  initial_pitch += best_delta;
+  if (testing_on)
+    tprintf ("tune_row_pitch3:output pitch=%g, sd=%g\n", initial_pitch,
+      best_sd);
+
+  if (textord_debug_pitch_metric)
+    print_pitch_sd(row,
+                   projection,
+                   projection_left,
+                   projection_right,
+                   space_size,
+                   initial_pitch);
+
+  return best_sd;
+}
+
+
+/**********************************************************************
+ * autocorr_pitch_delta
+ *
+ * Return the offset from initial_pitch, within +/- range, of the lag
+ * at which the mean-removed projection has the highest autocorrelation.
+ * Returns 0 if the projection is too short to judge.
+ **********************************************************************/
+
+INT16 autocorr_pitch_delta(                         //find periodicity
+                           STATS *projection,       //vertical projection
+                           INT16 projection_left,   //edge of projection
+                           INT16 projection_right,  //edge of projection
+                           float initial_pitch,     //guess at pitch
+                           INT32 range              //max offset
+                          ) {
+  INT16 pixel;                   //pixel coord
+  INT16 pitch_delta;             //offset pitch
+  INT16 best_delta;              //best offset
+  INT32 lag;                     //pitch in pixels
+  INT32 width;                   //of projection
+  float mean;                    //of projection
+  float sum;                     //correlation
+  float best_sum;                //best correlation
+  float *values;                 //mean removed projection
+
+  width = projection_right - projection_left + 1;
+  lag = (INT32) floor (initial_pitch + 0.5);
+  if (lag - range < 1 || width < (lag + range) * 2)
+    return 0;
+  values = new float[width];
+  mean = 0.0f;
+  for (pixel = 0; pixel < width; pixel++) {
+    values[pixel] = projection->pile_count (projection_left + pixel);
+    mean += values[pixel];
+  }
+  mean /= width;
+  for (pixel = 0; pixel < width; pixel++)
+    values[pixel] -= mean;
+  best_delta = 0;
+  best_sum = -MAX_FLOAT32;
+  for (pitch_delta = -range; pitch_delta <= range; pitch_delta++) {
+    sum = 0.0f;
+    for (pixel = 0; pixel + lag + pitch_delta < width; pixel++)
+      sum += values[pixel] * values[pixel + lag + pitch_delta];
+    sum /= width - lag - pitch_delta;
+    if (sum > best_sum
+    || (sum == best_sum && abs (pitch_delta) < abs (best_delta))) {
+      best_sum = sum;
+      best_delta = pitch_delta;
+    }
+  }
+  delete[]values;
+  return best_delta;
+}
+
+
 /**********************************************************************
  * compute_pitch_sd
  *
@@ -35,6 +35,8 @@ extern BOOL_VAR_H (textord_blockndoc_fixed, TRUE,
 "Attempt whole doc/block fixed pitch");
 extern BOOL_VAR_H (textord_fast_pitch_test, FALSE,
 "Do even faster pitch algorithm");
+extern BOOL_VAR_H (textord_autocorr_pitch_test, FALSE,
+"Pick pitch from projection autocorrelation");
 extern double_VAR_H (textord_projection_scale, 0.125,
 "Ding rate for mid-cuts");
 extern double_VAR_H (textord_balance_factor, 2.0,
@@ -145,6 +147,25 @@ float tune_row_pitch2(                             //find fp cells
                       ICOORDELT_LIST *best_cells,  //row cells
                       BOOL8 testing_on             //inidividual words
                      );
+float tune_row_pitch3(                             //find fp cells
+                      TO_ROW *row,                 //row to do
+                      STATS *projection,           //vertical projection
+                      INT16 projection_left,       //edge of projection
+                      INT16 projection_right,      //edge of projection
+                      float space_size,            //size of blank
+                      float &initial_pitch,        //guess at pitch
+                      float &best_sp_sd,           //space sd
+                      INT16 &best_mid_cuts,        //no of cheap cuts
+                      ICOORDELT_LIST *best_cells,  //row cells
+                      BOOL8 testing_on             //inidividual words
+                     );
+INT16 autocorr_pitch_delta(                         //find periodicity
+                           STATS *projection,       //vertical projection
+                           INT16 projection_left,   //edge of projection
+                           INT16 projection_right,  //edge of projection
+                           float initial_pitch,     //guess at pitch
+                           INT32 range              //max offset
+                          );
 float compute_pitch_sd (         //find fp cells
 TO_ROW * row,                    //row to do
 STATS * projection,              //vertical projection
@@ -85,6 +85,12 @@ EXTERN double_VAR (textord_blshift_maxshift, 0.00, "Max baseline shift");
 EXTERN double_VAR (textord_blshift_xfraction, 9.99,
 "Min size of baseline shift");
 EXTERN STRING_EVAR (tessedit_image_ext, ".tif", "Externsion for image file");
+EXTERN BOOL_VAR (textord_block_orientation, FALSE,
+"Find and upright sideways blocks");
+EXTERN INT_VAR (textord_orientation_min_blobs, 10,
+"Min blobs to decide block orientation");
+EXTERN double_VAR (textord_orientation_ratio, 2.0,
+"Side/bottom alignment ratio for sideways");
 
 #ifndef EMBEDDED
 EXTERN clock_t previous_cpu;
@@ -131,7 +137,8 @@ void read_and_textord(                       //read .pb file
   }
   fclose(infp);
 
-  assign_blobs_to_blocks2(blocks, &land_blocks, &port_blocks);
+  assign_blobs_to_blocks2(page_box.topright (), blocks,
+    &land_blocks, &port_blocks);
   filter_blobs (page_box.topright (), &port_blocks, !textord_test_landscape);
   filter_blobs (page_box.topright (), &land_blocks, textord_test_landscape);
   textord_page (page_box.topright (), blocks, &land_blocks, &port_blocks);
@@ -231,7 +238,7 @@ void edges_and_textord(                       //read .pb file
     global_monitor->progress = 10;
   }
 
-  assign_blobs_to_blocks2(blocks, &land_blocks, &port_blocks);
+  assign_blobs_to_blocks2(page_tr, blocks, &land_blocks, &port_blocks);
   if (global_monitor != NULL)
     global_monitor->ocr_alive = TRUE;
   filter_blobs (page_box.topright (), &land_blocks, textord_test_landscape);
@@ -251,6 +258,7 @@ void edges_and_textord(                       //read .pb file
  **********************************************************************/
 
 void assign_blobs_to_blocks2(                             //split into groups
+                             ICOORD page_tr,              //top right of page
                              BLOCK_LIST *blocks,          //blocks to process
                              TO_BLOCK_LIST *land_blocks,  //rotated for landscape
                              TO_BLOCK_LIST *port_blocks   //output list
@@ -268,6 +276,8 @@ void assign_blobs_to_blocks2(                             //split into groups
   for (block_it.mark_cycle_pt (); !block_it.cycled_list ();
   block_it.forward ()) {
     block = block_it.data ();
+    if (textord_block_orientation)
+      orient_block(block, page_tr);
     blob_it.set_to_list (block->blob_list ());
                                  //make one
     port_block = new TO_BLOCK (block);
@@ -287,6 +297,148 @@ void assign_blobs_to_blocks2(                             //split into groups
 }
 
 
+/**********************************************************************
+ * edge_alignment
+ *
+ * Measure how well a set of blob edges line up, as the sum of the
+ * squares of the counts in 2 pixel bins over the square of the total.
+ **********************************************************************/
+
+static float edge_alignment(              //line up measure
+                            STATS *edges  //edges / 2
+                           ) {
+  INT32 index;                   //bin index
+  INT32 count;                   //in bin
+  float sum;                     //of squares
+
+  if (edges->get_total () == 0)
+    return 0.0f;
+  sum = 0.0f;
+  for (index = edges->min_bucket (); index <= edges->max_bucket (); index++) {
+    count = edges->pile_count (index);
+    sum += (float) count *count;
+  }
+  return sum / ((float) edges->get_total () * edges->get_total ());
+}
+
+
+/**********************************************************************
+ * find_block_orientation
+ *
+ * Guess from the blob boxes whether the text of a block runs sideways.
+ * Text lines make the bottoms (and tops) of the blobs line up. If the
+ * lefts or rights line up much better, the lines are vertical, and the
+ * side with the better alignment is taken to be the baseline.
+ * Returns the rotation that makes the block upright.
+ **********************************************************************/
+
+FCOORD find_block_orientation(                  //sideways?
+                              BLOCK *block      //block to test
+                             ) {
+  BOX block_box = block->bounding_box ();
+  BOX blob_box;                  //current blob
+  C_BLOB_IT blob_it = block->blob_list ();
+  STATS lefts (block_box.left () / 2, block_box.right () / 2 + 1);
+  STATS rights (block_box.left () / 2, block_box.right () / 2 + 1);
+  STATS bottoms (block_box.bottom () / 2, block_box.top () / 2 + 1);
+  STATS tops (block_box.bottom () / 2, block_box.top () / 2 + 1);
+  float horizontal;              //alignment measures
+  float left_align;
+  float right_align;
+
+  for (blob_it.mark_cycle_pt (); !blob_it.cycled_list (); blob_it.forward ()) {
+    blob_box = blob_it.data ()->bounding_box ();
+    if (blob_box.width () <= textord_max_noise_size
+      && blob_box.height () <= textord_max_noise_size)
+      continue;                  //ignore specks
+    lefts.add (blob_box.left () / 2, 1);
+    rights.add (blob_box.right () / 2, 1);
+    bottoms.add (blob_box.bottom () / 2, 1);
+    tops.add (blob_box.top () / 2, 1);
+  }
+  if (lefts.get_total () < textord_orientation_min_blobs)
+    return FCOORD (1.0f, 0.0f);
+  horizontal = MAX (edge_alignment (&bottoms), edge_alignment (&tops));
+  left_align = edge_alignment (&lefts);
+  right_align = edge_alignment (&rights);
+  if (MAX (left_align, right_align) < horizontal * textord_orientation_ratio)
+    return FCOORD (1.0f, 0.0f);
+  if (right_align > left_align)
+    return FCOORD (0.0f, -1.0f); //baseline on right
+  else
+    return FCOORD (0.0f, 1.0f);  //baseline on left
+}
+
+
+/**********************************************************************
+ * rotate_blob_list
+ *
+ * Replace each blob in the list by a rotated and shifted copy.
+ **********************************************************************/
+
+static void rotate_blob_list(                     //rotate blobs
+                             C_BLOB_LIST *blobs,  //blobs to rotate
+                             FCOORD rotation,     //rotation
+                             ICOORD shift         //then move
+                            ) {
+  C_BLOB_IT blob_it = blobs;
+  C_BLOB_LIST rotated_blobs;     //rotated copies
+  C_BLOB_IT rotated_it = &rotated_blobs;
+  C_BLOB *blob;                  //rotated copy
+
+  for (blob_it.mark_cycle_pt (); !blob_it.cycled_list (); blob_it.forward ()) {
+    blob = crotate_cblob (blob_it.data (), rotation);
+    blob->move (shift);
+    rotated_it.add_after_then_move (blob);
+  }
+  blobs->clear ();               //lose originals
+  blob_it.set_to_list (blobs);
+  blob_it.add_list_after (&rotated_blobs);
+}
+
+
+/**********************************************************************
+ * orient_block
+ *
+ * If the text of the block runs sideways, rotate the block and its blobs
+ * into an upright frame, keeping the bottom left corner of the block
+ * where it was unless that would push the upright block off the page.
+ * The block remembers the rotation so that results can be mapped back
+ * to the page.
+ **********************************************************************/
+
+void orient_block(              //upright sideways block
+                  BLOCK *block,   //block to do
+                  ICOORD page_tr //top right of page
+                 ) {
+  FCOORD rotation;               //to upright frame
+  ICOORD shift;                  //to new corner
+  ICOORD corner;                 //new bottom left
+  BOX upright_box;               //rotated block box
+
+  rotation = find_block_orientation (block);
+  if (rotation.y () == 0.0f)
+    return;                      //already upright
+  corner = block->bounding_box ().botleft ();
+  block->rotate (rotation);
+  upright_box = block->bounding_box ();
+                                 //keep it on the page
+  if (corner.x () + upright_box.width () > page_tr.x ())
+    corner.set_x (page_tr.x () - upright_box.width ());
+  if (corner.x () < 0)
+    corner.set_x (0);
+  if (corner.y () + upright_box.height () > page_tr.y ())
+    corner.set_y (page_tr.y () - upright_box.height ());
+  if (corner.y () < 0)
+    corner.set_y (0);
+  shift = corner - upright_box.botleft ();
+  block->move (shift);
+  rotate_blob_list (block->blob_list (), rotation, shift);
+  rotate_blob_list (block->reject_blobs (), rotation, shift);
+  block->set_rotation (rotation, shift);
+}
+
+
 /**********************************************************************
  * filter_blobs
  *
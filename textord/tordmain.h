@@ -66,6 +66,12 @@ extern double_VAR_H (textord_blshift_xfraction, 9.99,
 "Min size of baseline shift");
                                  //xiaofan
 extern STRING_EVAR_H (tessedit_image_ext, ".tif", "Externsion for image file");
+extern BOOL_VAR_H (textord_block_orientation, FALSE,
+"Find and upright sideways blocks");
+extern INT_VAR_H (textord_orientation_min_blobs, 10,
+"Min blobs to decide block orientation");
+extern double_VAR_H (textord_orientation_ratio, 2.0,
+"Side/bottom alignment ratio for sideways");
 extern clock_t previous_cpu;
 void make_blocks_from_blobs(                       //convert & textord
                             TBLOB *tessblobs,      //tess style input
@@ -87,10 +93,18 @@ void assign_blobs_to_blocks(                             //split into groups
                             TO_BLOCK_LIST *port_blocks   //output list
                            );
 void assign_blobs_to_blocks2(                             //split into groups
+                             ICOORD page_tr,              //top right of page
                              BLOCK_LIST *blocks,          //blocks to process
                              TO_BLOCK_LIST *land_blocks,  //rotated for landscape
                              TO_BLOCK_LIST *port_blocks   //output list
                             );
+FCOORD find_block_orientation(                  //sideways?
+                              BLOCK *block      //block to test
+                             );
+void orient_block(              //upright sideways block
+                  BLOCK *block,   //block to do
+                  ICOORD page_tr //top right of page
+                 );
 void filter_blobs(                        //split into groups
                   ICOORD page_tr,         //top right
                   TO_BLOCK_LIST *blocks,  //output list
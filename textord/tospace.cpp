@@ -127,6 +127,7 @@ void to_spacing(                       //set spacing
                                  //Old fixed/prop result
   BOOL8 old_text_ord_proportional;
   GAPMAP *gapmap = NULL;         //map of big vert gaps in blk
+  ROW_GAPS **row_gaps;           //gaps of each row
 
   block_it.set_to_list (blocks);
   block_index = 1;
@@ -134,12 +135,25 @@ void to_spacing(                       //set spacing
   block_it.forward ()) {
     block = block_it.data ();
     gapmap = new GAPMAP (block);
+    row_it.set_to_list (block->get_rows ());
+    row_gaps = new ROW_GAPS *[row_it.length () + 1];
+    row_index = 0;
+    for (row_it.mark_cycle_pt (); !row_it.cycled_list (); row_it.forward ()) {
+      row = row_it.data ();
+      if (!tosp_only_use_prop_rows
+        || row->pitch_decision == PITCH_DEF_PROP
+        || row->pitch_decision == PITCH_CORR_PROP)
+        row_gaps[row_index] = new ROW_GAPS (row, gapmap);
+      else
+        row_gaps[row_index] = NULL;
+      row_index++;
+    }
     block_spacing_stats(block,
                         gapmap,
+                        row_gaps,
                         old_text_ord_proportional,
                         block_space_gap_width,
                         block_non_space_gap_width);
-    row_it.set_to_list (block->get_rows ());
     row_index = 1;
     for (row_it.mark_cycle_pt (); !row_it.cycled_list (); row_it.forward ()) {
       row = row_it.data ();
@@ -149,7 +163,7 @@ void to_spacing(                       //set spacing
           tprintf ("Block %d Row %d: Now Proportional\n",
             block_index, row_index);
         row_spacing_stats(row,
-                          gapmap,
+                          row_gaps[row_index - 1],
                           block_index,
                           row_index,
                           block_space_gap_width,
@@ -168,6 +182,11 @@ void to_spacing(                       //set spacing
 #endif
       row_index++;
     }
+    for (row_index = 0; row_index < row_it.length (); row_index++) {
+      if (row_gaps[row_index] != NULL)
+        delete row_gaps[row_index];
+    }
+    delete[]row_gaps;
     delete gapmap;
     block_index++;
   }
@@ -181,13 +200,16 @@ void to_spacing(                       //set spacing
 void block_spacing_stats(                                  //DEBUG USE ONLY
                          TO_BLOCK *block,
                          GAPMAP *gapmap,
+                         ROW_GAPS **row_gaps,              //gaps of rows
                          BOOL8 &old_text_ord_proportional,
                          INT16 &block_space_gap_width,     //resulting estimate
                          INT16 &block_non_space_gap_width  //resulting estimate
                         ) {
   TO_ROW_IT row_it;              //row iterator
   TO_ROW *row;                   //current row
-  BLOBNBOX_IT blob_it;           //iterator
+  ROW_GAPS *gaps;                //gaps of current row
+  INT32 row_index;               //index in row_gaps
+  INT32 box_index;               //index in gaps
 
   STATS centre_to_centre_stats (0, MAXSPACING);
   //DEBUG USE ONLY
@@ -201,41 +223,25 @@ void block_spacing_stats(                                  //DEBUG USE ONLY
   float real_space_threshold;
   float iqr_centre_to_centre;    //DEBUG USE ONLY
   float iqr_all_gap_stats;       //DEBUG USE ONLY
-  INT32 end_of_row;
   INT32 row_length;
 
   row_it.set_to_list (block->get_rows ());
-  for (row_it.mark_cycle_pt (); !row_it.cycled_list (); row_it.forward ()) {
+  row_index = 0;
+  for (row_it.mark_cycle_pt (); !row_it.cycled_list ();
+  row_it.forward (), row_index++) {
     row = row_it.data ();
-    if (!row->blob_list ()->empty () &&
-      (!tosp_only_use_prop_rows ||
-      (row->pitch_decision == PITCH_DEF_PROP) ||
-    (row->pitch_decision == PITCH_CORR_PROP))) {
-      blob_it.set_to_list (row->blob_list ());
-      blob_it.mark_cycle_pt ();
-      end_of_row = blob_it.data_relative (-1)->bounding_box ().right ();
-      if (tosp_use_pre_chopping)
-        blob_box = box_next_pre_chopped (&blob_it);
-      else if (tosp_stats_use_xht_gaps)
-        blob_box = reduced_box_next (row, &blob_it);
-      else
-        blob_box = box_next (&blob_it);
-      row_length = end_of_row - blob_box.left ();
+    gaps = row_gaps[row_index];
+    if (gaps != NULL && gaps->box_count > 0) {
+      blob_box = gaps->boxes[0];
       if (blob_box.width () < minwidth)
         minwidth = blob_box.width ();
       prev_blob_box = blob_box;
-      while (!blob_it.cycled_list ()) {
-        if (tosp_use_pre_chopping)
-          blob_box = box_next_pre_chopped (&blob_it);
-        else if (tosp_stats_use_xht_gaps)
-          blob_box = reduced_box_next (row, &blob_it);
-        else
-          blob_box = box_next (&blob_it);
+      for (box_index = 1; box_index < gaps->box_count; box_index++) {
+        blob_box = gaps->boxes[box_index];
         if (blob_box.width () < minwidth)
           minwidth = blob_box.width ();
         gap_width = blob_box.left () - prev_blob_box.right ();
-        if (!ignore_big_gap (row, row_length, gapmap,
-        prev_blob_box.right (), blob_box.left ())) {
+        if (!gaps->big_gap[box_index]) {
           all_gap_stats.add (gap_width, 1);
 
           centre_to_centre = (blob_box.left () + blob_box.right () -
@@ -279,34 +285,20 @@ void block_spacing_stats(                                  //DEBUG USE ONLY
     // median gap
 
     row_it.set_to_list (block->get_rows ());
-    for (row_it.mark_cycle_pt (); !row_it.cycled_list (); row_it.forward ()) {
+    row_index = 0;
+    for (row_it.mark_cycle_pt (); !row_it.cycled_list ();
+    row_it.forward (), row_index++) {
       row = row_it.data ();
-      if (!row->blob_list ()->empty () &&
-        (!tosp_only_use_prop_rows ||
-        (row->pitch_decision == PITCH_DEF_PROP) ||
-      (row->pitch_decision == PITCH_CORR_PROP))) {
+      gaps = row_gaps[row_index];
+      if (gaps != NULL && gaps->box_count > 0) {
         real_space_threshold =
           MAX (tosp_init_guess_kn_mult * block_non_space_gap_width,
           tosp_init_guess_xht_mult * row->xheight);
-        blob_it.set_to_list (row->blob_list ());
-        blob_it.mark_cycle_pt ();
-        end_of_row =
-          blob_it.data_relative (-1)->bounding_box ().right ();
-        if (tosp_use_pre_chopping)
-          blob_box = box_next_pre_chopped (&blob_it);
-        else if (tosp_stats_use_xht_gaps)
-          blob_box = reduced_box_next (row, &blob_it);
-        else
-          blob_box = box_next (&blob_it);
-        row_length = blob_box.left () - end_of_row;
-        prev_blob_box = blob_box;
-        while (!blob_it.cycled_list ()) {
-          if (tosp_use_pre_chopping)
-            blob_box = box_next_pre_chopped (&blob_it);
-          else if (tosp_stats_use_xht_gaps)
-            blob_box = reduced_box_next (row, &blob_it);
-          else
-            blob_box = box_next (&blob_it);
+                                 //NB negative as before
+        row_length = -gaps->row_length;
+        prev_blob_box = gaps->boxes[0];
+        for (box_index = 1; box_index < gaps->box_count; box_index++) {
+          blob_box = gaps->boxes[box_index];
           gap_width = blob_box.left () - prev_blob_box.right ();
           if ((gap_width > real_space_threshold) &&
             !ignore_big_gap (row, row_length, gapmap,
@@ -354,14 +346,12 @@ void block_spacing_stats(                                  //DEBUG USE ONLY
 
 void row_spacing_stats(                                 //estimate for block
                        TO_ROW *row,
-                       GAPMAP *gapmap,
+                       ROW_GAPS *gaps,                  //boxes & big gaps
                        INT16 block_idx,
                        INT16 row_idx,
                        INT16 block_space_gap_width,
                        INT16 block_non_space_gap_width  //estimate for block
                       ) {
-                                 //iterator
-  BLOBNBOX_IT blob_it = row->blob_list ();
   STATS all_gap_stats (0, MAXSPACING);
   STATS cert_space_gap_stats (0, MAXSPACING);
   STATS all_space_gap_stats (0, MAXSPACING);
@@ -376,7 +366,7 @@ void row_spacing_stats(                                 //estimate for block
   BOOL8 suspected_table;
   INT32 max_max_nonspace;        //upper bound
   BOOL8 good_block_space_estimate = block_space_gap_width > 0;
-  INT32 end_of_row;
+  INT32 box_index;               //index in gaps
   INT32 row_length = 0;
   float sane_space;
   INT32 sane_threshold;
@@ -385,7 +375,7 @@ void row_spacing_stats(                                 //estimate for block
 
   if (!good_block_space_estimate)
     block_space_gap_width = INT16 (floor (row->xheight / 2));
-  if (!row->blob_list ()->empty ()) {
+  if (gaps->box_count > 0) {
     if (tosp_threshold_bias1 > 0)
       real_space_threshold =
         block_non_space_gap_width +
@@ -395,27 +385,12 @@ void row_spacing_stats(                                 //estimate for block
     else
       real_space_threshold =     //Old TO method
         (block_space_gap_width + block_non_space_gap_width) / 2;
-    blob_it.set_to_list (row->blob_list ());
-    blob_it.mark_cycle_pt ();
-    end_of_row = blob_it.data_relative (-1)->bounding_box ().right ();
-    if (tosp_use_pre_chopping)
-      blob_box = box_next_pre_chopped (&blob_it);
-    else if (tosp_stats_use_xht_gaps)
-      blob_box = reduced_box_next (row, &blob_it);
-    else
-      blob_box = box_next (&blob_it);
-    row_length = end_of_row - blob_box.left ();
-    prev_blob_box = blob_box;
-    while (!blob_it.cycled_list ()) {
-      if (tosp_use_pre_chopping)
-        blob_box = box_next_pre_chopped (&blob_it);
-      else if (tosp_stats_use_xht_gaps)
-        blob_box = reduced_box_next (row, &blob_it);
-      else
-        blob_box = box_next (&blob_it);
+    row_length = gaps->row_length;
+    prev_blob_box = gaps->boxes[0];
+    for (box_index = 1; box_index < gaps->box_count; box_index++) {
+      blob_box = gaps->boxes[box_index];
       gap_width = blob_box.left () - prev_blob_box.right ();
-      if (ignore_big_gap (row, row_length, gapmap,
-        prev_blob_box.right (), blob_box.left ()))
+      if (gaps->big_gap[box_index])
         large_gap_count++;
       else {
         if (gap_width >= real_space_threshold) {
@@ -456,7 +431,7 @@ void row_spacing_stats(                                 //estimate for block
                   block_non_space_gap_width);
   else {
     if (!tosp_recovery_isolated_row_stats ||
-      !isolated_row_stats (row, gapmap, &all_gap_stats, suspected_table,
+      !isolated_row_stats (row, gaps, &all_gap_stats, suspected_table,
     block_idx, row_idx)) {
       if (tosp_row_use_cert_spaces && (tosp_debug_level > 5))
         tprintf ("B:%d R:%d -- Inadequate certain spaces.\n",
@@ -717,7 +692,7 @@ void old_to_method(                                 //estimate for block
  *************************************************************************/
 
 BOOL8 isolated_row_stats(TO_ROW *row,
-                         GAPMAP *gapmap,
+                         ROW_GAPS *gaps,
                          STATS *all_gap_stats,
                          BOOL8 suspected_table,
                          INT16 block_idx,
@@ -726,16 +701,13 @@ BOOL8 isolated_row_stats(TO_ROW *row,
   float crude_threshold_estimate;
   INT16 small_gaps_count;
   INT16 total;
-                                 //iterator
-  BLOBNBOX_IT blob_it = row->blob_list ();
   STATS cert_space_gap_stats (0, MAXSPACING);
   STATS all_space_gap_stats (0, MAXSPACING);
   STATS small_gap_stats (0, MAXSPACING);
   BOX blob_box;
   BOX prev_blob_box;
   INT16 gap_width;
-  INT32 end_of_row;
-  INT32 row_length;
+  INT32 box_index;               //index in gaps
 
   kern_estimate = all_gap_stats->median ();
   crude_threshold_estimate = MAX (tosp_init_guess_kn_mult * kern_estimate,
@@ -753,27 +725,11 @@ BOOL8 isolated_row_stats(TO_ROW *row,
         block_idx, row_idx);
     return FALSE;
   }
-  blob_it.set_to_list (row->blob_list ());
-  blob_it.mark_cycle_pt ();
-  end_of_row = blob_it.data_relative (-1)->bounding_box ().right ();
-  if (tosp_use_pre_chopping)
-    blob_box = box_next_pre_chopped (&blob_it);
-  else if (tosp_stats_use_xht_gaps)
-    blob_box = reduced_box_next (row, &blob_it);
-  else
-    blob_box = box_next (&blob_it);
-  row_length = end_of_row - blob_box.left ();
-  prev_blob_box = blob_box;
-  while (!blob_it.cycled_list ()) {
-    if (tosp_use_pre_chopping)
-      blob_box = box_next_pre_chopped (&blob_it);
-    else if (tosp_stats_use_xht_gaps)
-      blob_box = reduced_box_next (row, &blob_it);
-    else
-      blob_box = box_next (&blob_it);
+  prev_blob_box = gaps->boxes[0];
+  for (box_index = 1; box_index < gaps->box_count; box_index++) {
+    blob_box = gaps->boxes[box_index];
     gap_width = blob_box.left () - prev_blob_box.right ();
-    if (!ignore_big_gap (row, row_length, gapmap,
-      prev_blob_box.right (), blob_box.left ()) &&
+    if (!gaps->big_gap[box_index] &&
     (gap_width > crude_threshold_estimate)) {
       if ((gap_width > tosp_fuzzy_space_factor2 * row->xheight) ||
         ((gap_width > tosp_fuzzy_space_factor1 * row->xheight) &&
@@ -1764,6 +1720,62 @@ BOOL8 ignore_big_gap(TO_ROW *row,
 }
 
 
+/**********************************************************************
+ * ROW_GAPS::ROW_GAPS
+ *
+ * Walk the row once, in the same way as the spacing stats always did,
+ * keeping each box and whether the gap before it is to be ignored.
+ **********************************************************************/
+
+ROW_GAPS::ROW_GAPS(                   //constructor
+                   TO_ROW *row,       //row to scan
+                   GAPMAP *gapmap     //map of big vert gaps
+                  ) {
+  BLOBNBOX_IT blob_it = row->blob_list ();
+  INT32 end_of_row;              //right of last blob
+
+  box_count = 0;
+  row_length = 0;
+  boxes = NULL;
+  big_gap = NULL;
+  if (row->blob_list ()->empty ())
+    return;
+  boxes = new BOX[blob_it.length ()];
+  big_gap = new BOOL8[blob_it.length ()];
+  blob_it.mark_cycle_pt ();
+  end_of_row = blob_it.data_relative (-1)->bounding_box ().right ();
+  while (!blob_it.cycled_list ()) {
+    if (tosp_use_pre_chopping)
+      boxes[box_count] = box_next_pre_chopped (&blob_it);
+    else if (tosp_stats_use_xht_gaps)
+      boxes[box_count] = reduced_box_next (row, &blob_it);
+    else
+      boxes[box_count] = box_next (&blob_it);
+    if (box_count == 0) {
+      row_length = end_of_row - boxes[0].left ();
+      big_gap[0] = FALSE;
+    }
+    else
+      big_gap[box_count] = ignore_big_gap (row, row_length, gapmap,
+        boxes[box_count - 1].right (),
+        boxes[box_count].left ());
+    box_count++;
+  }
+}
+
+
+/**********************************************************************
+ * ROW_GAPS::~ROW_GAPS
+ **********************************************************************/
+
+ROW_GAPS::~ROW_GAPS () {
+  if (boxes != NULL)
+    delete[]boxes;
+  if (big_gap != NULL)
+    delete[]big_gap;
+}
+
+
 /**********************************************************************
  * reduced_box_next
  *
@@ -1856,12 +1868,16 @@ BOX reduced_box_for_blob(BLOBNBOX *blob, TO_ROW *row, INT16 *left_above_xht) {
   float right_limit;
   float junk;
   BOX blob_box;
+  C_BLOB_LIMITS *limits;         //tabulated cblob
 
   /* Find baseline of centre of blob */
 
   blob_box = blob->bounding_box ();
   blob_x_centre = (blob_box.left () + blob_box.right ()) / 2.0;
   baseline = row->baseline.y (blob_x_centre);
+  limits = NULL;
+  if (blob->blob () == NULL)
+    limits = new C_BLOB_LIMITS (blob->cblob ());
 
   /*
   Find LH limit of blob ABOVE the xht. This is so that we can detect certain
@@ -1879,7 +1895,7 @@ BOX reduced_box_for_blob(BLOBNBOX *blob, TO_ROW *row, INT16 *left_above_xht) {
       left_limit, junk);         //min y max_y
   else
                                  //blob to test
-    find_cblob_hlimits (blob->cblob (),
+    limits->find_hlimits (
                                  //rotated lower limit
       (baseline + 1.1 * row->xheight), (float) MAX_INT16,
     //rotated upper limit
@@ -1904,14 +1920,17 @@ BOX reduced_box_for_blob(BLOBNBOX *blob, TO_ROW *row, INT16 *left_above_xht) {
       left_limit, junk);         //min y max_y
   else
                                  //blob to test
-    find_cblob_hlimits (blob->cblob (),
+    limits->find_hlimits (
       baseline,                  //rotated upper limit
       (float) MAX_INT16,         //rotated lower limit
     //                                                              FCOORD( 0.0, 1.0 ),             //90deg anticlock rot
       left_limit, junk);         //min y max_y
 
-  if (left_limit > junk)
+  if (left_limit > junk) {
+    if (limits != NULL)
+      delete limits;
     return BOX ();               //no area within xht so return empty box
+  }
   /*
   Find reduced RH limit of blob - the right extent of the region BELOW the xht.
   */
@@ -1927,14 +1946,19 @@ BOX reduced_box_for_blob(BLOBNBOX *blob, TO_ROW *row, INT16 *left_above_xht) {
       junk, right_limit);        //min y max_y
   else
                                  //blob to test
-    find_cblob_hlimits (blob->cblob (),
+    limits->find_hlimits (
       (float) -MAX_INT16,        //rotated upper limit
       (baseline + row->xheight),
     //rotated lower limit
     //                                                              FCOORD( 0.0, 1.0 ),             //90deg anticlock rot
       junk, right_limit);        //min y max_y
-  if (junk > right_limit)
+  if (junk > right_limit) {
+    if (limits != NULL)
+      delete limits;
     return BOX ();               //no area within xht so return empty box
+  }
+  if (limits != NULL)
+    delete limits;
 
   return BOX (ICOORD ((INT16) floor (left_limit), blob_box.bottom ()),
     ICOORD ((INT16) ceil (right_limit), blob_box.top ()));
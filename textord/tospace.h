@@ -111,6 +111,31 @@ extern double_VAR_H (tosp_silly_kn_sp_gap, 0.2,
 "Dont let sp minus kn get too small");
 extern double_VAR_H (tosp_pass_wide_fuzz_sp_to_context, 0.75,
 "How wide fuzzies need context");
+
+/**********************************************************************
+ * ROW_GAPS
+ *
+ * The boxes of a row as seen by the spacing stats, with a flag for
+ * each gap saying whether ignore_big_gap rejected it. Built once per
+ * row so the block and row stats need not re-walk the blobs.
+ **********************************************************************/
+
+class ROW_GAPS
+{
+  public:
+    ROW_GAPS(                   //constructor
+             TO_ROW *row,       //row to scan
+             GAPMAP *gapmap);   //map of big vert gaps
+    ~ROW_GAPS ();
+
+    INT32 box_count;             //no of boxes
+    INT32 row_length;            //end of row - left of first
+    BOX *boxes;                  //boxes in order
+    BOOL8 *big_gap;              //gap before box ignored
+
+    NEWDELETE2 (ROW_GAPS)
+};
+
 void to_spacing(                       //set spacing
                 ICOORD page_tr,        //topright of page
                 TO_BLOCK_LIST *blocks  //blocks on page
@@ -118,13 +143,14 @@ void to_spacing(                       //set spacing
                                  //DEBUG USE ONLY
 void block_spacing_stats(TO_BLOCK *block,
                          GAPMAP *gapmap,
+                         ROW_GAPS **row_gaps,              //gaps of rows
                          BOOL8 &old_text_ord_proportional,
                          INT16 &block_space_gap_width,     //resulting estimate
                          INT16 &block_non_space_gap_width  //resulting estimate
                         );
                                  //estimate for block
 void row_spacing_stats(TO_ROW *row,
-                       GAPMAP *gapmap,
+                       ROW_GAPS *gaps,                  //boxes & big gaps
                        INT16 block_idx,
                        INT16 row_idx,
                        INT16 block_space_gap_width,
@@ -139,7 +165,7 @@ void old_to_method(TO_ROW *row,
                    INT16 block_non_space_gap_width  //estimate for block
                   );
 BOOL8 isolated_row_stats(TO_ROW *row,
-                         GAPMAP *gapmap,
+                         ROW_GAPS *gaps,
                          STATS *all_gap_stats,
                          BOOL8 suspected_table,
                          INT16 block_idx,
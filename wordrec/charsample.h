@@ -88,14 +88,34 @@ class CHAR_SAMPLE:public ELIST_LINK
       return ch;
     }
 
+    INT32 width() {
+      return sample_width;
+    }
+
+    INT32 height() {
+      return sample_height;
+    }
+
+    INT32 ink_count() {  //-1 if unknown
+      return sample_ink;
+    }
+
+                                 //cheap size/ink test
+    BOOL8 coarse_match(CHAR_SAMPLE *test_sample, double max_ratio);
+
     void print(FILE *f);
 
     void reset_match_statistics();
 
     NEWDELETE2 (CHAR_SAMPLE) private:
+    void find_extent();  //set size and ink count
+
     IMAGE * sample_image;
     PBLOB *sample_blob;
     DENORM *sample_denorm;
+    INT32 sample_width;
+    INT32 sample_height;
+    INT32 sample_ink;
     INT32 n_samples_matched;
     double total_match_scores;
     double sumsq_match_scores;
@@ -116,6 +136,10 @@ class CHAR_SAMPLES:public ELIST_LINK
       return samples.length ();
     }
 
+    CHAR_SAMPLE *representative() {  //first sample, for prefiltering
+      return rep_sample;
+    }
+
     void add_sample(CHAR_SAMPLE *sample);
 
     void build_prototype();
@@ -147,6 +171,7 @@ class CHAR_SAMPLES:public ELIST_LINK
     char ch;
     CHAR_PROTO *proto;
     CHAR_SAMPLE *best_sample;
+    CHAR_SAMPLE *rep_sample;
     CHAR_SAMPLE_LIST samples;
 };
 
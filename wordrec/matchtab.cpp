@@ -29,6 +29,7 @@
 #include "freelist.h"
 #include "callcpp.h"
 #include "blobs.h"
+#include "tprintf.h"
 
 /*----------------------------------------------------------------------
               T y p e s
@@ -70,6 +71,7 @@ MATCH *match_table;
  * Create and clear a match table to be used to speed up the splitter.
  **********************************************************************/
 static int been_initialized = 0;
+static TPRINTF_COUNTER match_table_full ("Match table full");
 void init_match_table() {
   int x;
 
@@ -137,7 +139,8 @@ void put_match(TBLOB *blob, CHOICES ratings) {
   }
   while (x != start);
 
-  cprintf ("error: Match table is full\n");
+  if (match_table_full.count ())
+    cprintf ("error: Match table is full\n");
 }
 
 